@@ -26,17 +26,20 @@
 
 #define WEBRTC_INCLUDE_INTERNAL_AUDIO_DEVICE 1
 
+#include <atomic>
 #include <chrono>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <AL/al.h>
 #include <AL/alc.h>
 
 #include "api/audio/audio_frame.h"
 #include "api/audio/audio_mixer.h"
+#include "absl/functional/any_invocable.h"
 #include "api/media_stream_interface.h"
 #include "api/sequence_checker.h"
 #include "api/task_queue/task_queue_factory.h"
@@ -61,12 +64,23 @@
 class ExtendedADM : public webrtc::AudioDeviceModule {
  public:
   // Creates a new `bridge::LocalAudioSource` that will record audio from the
-  // device with the provided ID.
+  // device with the provided ID in the provided `RecordingFormat`, and process
+  // it according to the provided `AudioOptions`.
   virtual rtc::scoped_refptr<bridge::LocalAudioSource> CreateAudioSource(
-      uint32_t device_index) = 0;
+      uint32_t device_index,
+      RecordingFormat format,
+      cricket::AudioOptions options) = 0;
 
   // Stops the `bridge::LocalAudioSource` for the provided device ID.
   virtual void DisposeAudioSource(std::string device_id) = 0;
+
+  // Sets the number of 10 ms buffers kept queued for playout, trading the
+  // playout latency against the risk of underruns.
+  virtual int32_t SetPlayoutBufferDepth(uint16_t buffers) = 0;
+
+  // Calls the provided mutating `task` on this `ExtendedADM` on its thread,
+  // without waiting for it to complete.
+  virtual void CallAsync(absl::AnyInvocable<void(ExtendedADM&) &&> task) = 0;
 };
 
 class OpenALAudioDeviceModule : public ExtendedADM {
@@ -83,13 +97,28 @@ class OpenALAudioDeviceModule : public ExtendedADM {
   bool Initialized() const override;
 
   // Creates a new `bridge::LocalAudioSource` that will record audio from the
-  // device with the provided ID.
+  // device with the provided ID in the provided `RecordingFormat`, and process
+  // it according to the provided `AudioOptions`.
+  //
+  // Returns `nullptr` if the `RecordingFormat` is not supported, or the device
+  // is being recorded already.
   rtc::scoped_refptr<bridge::LocalAudioSource> CreateAudioSource(
-      uint32_t device_index) override;
+      uint32_t device_index,
+      RecordingFormat format,
+      cricket::AudioOptions options) override;
 
   // Stops the `bridge::LocalAudioSource` for the provided device ID.
   void DisposeAudioSource(std::string device_id) override;
 
+  // Sets the number of 10 ms buffers kept queued for playout.
+  //
+  // Restarts the playout if it's active already.
+  int32_t SetPlayoutBufferDepth(uint16_t buffers) override;
+
+  // Calls the provided `task` right away, as this `OpenALAudioDeviceModule` is
+  // only accessed on its thread.
+  void CallAsync(absl::AnyInvocable<void(ExtendedADM&) &&> task) override;
+
   // Playout control.
   int16_t PlayoutDevices() override;
   int32_t SetPlayoutDevice(uint16_t index) override;
@@ -166,7 +195,8 @@ class OpenALAudioDeviceModule : public ExtendedADM {
 
   int32_t GetPlayoutUnderrunCount() const override { return -1; }
 
-  virtual absl::optional<Stats> GetStats() const { return absl::nullopt; }
+  // Returns the playout statistics, including the measured playout delay.
+  absl::optional<Stats> GetStats() const override;
 
 #if defined(WEBRTC_IOS)
   virtual int GetPlayoutAudioParameters(AudioParameters* params) const {
@@ -181,6 +211,28 @@ class OpenALAudioDeviceModule : public ExtendedADM {
  private:
   struct Data;
 
+  // Flags of the `_state` snapshot.
+  enum StateFlag : uint32_t {
+    kInitialized = 1 << 0,
+    kPlayoutInitialized = 1 << 1,
+    kRecordingInitialized = 1 << 2,
+    kSpeakerInitialized = 1 << 3,
+    kMicrophoneInitialized = 1 << 4,
+    kPlaying = 1 << 5,
+    kRecording = 1 << 6,
+    kStereoPlayout = 1 << 7,
+  };
+
+  // Sets or clears the provided flags of the `_state` snapshot.
+  void setState(uint32_t flags, bool enabled);
+
+  // Indicates whether the provided flag of the `_state` snapshot is set.
+  bool hasState(StateFlag flag) const;
+
+  // Snapshot of the `StateFlag`s, updated on every state change, so the state
+  // can be queried from any thread without blocking on the ADM thread.
+  std::atomic<uint32_t> _state = kStereoPlayout;
+
   bool _initialized = false;
   std::unique_ptr<Data> _data;
 
@@ -208,12 +260,47 @@ class OpenALAudioDeviceModule : public ExtendedADM {
 
   void processPlayoutQueued();
 
+  // Subscribes to `AL_SOFT_events` of the playout source, so the playout
+  // buffers are refilled as soon as OpenAL completes them.
+  //
+  // Returns `false` if the extension is unavailable, so the playout buffers
+  // should be polled instead.
+  bool enablePlayoutEvents();
+
+  // Unsubscribes from `AL_SOFT_events` of the playout source.
+  void disablePlayoutEvents();
+
+  // Schedules refilling of the playout buffers on the playout thread.
+  void schedulePlayoutRefill();
+
+  // Handles `AL_SOFT_events` of the playout source.
+  //
+  // Called on an OpenAL internal thread.
+  static void onPlayoutEvent(ALenum eventType,
+                             ALuint object,
+                             ALuint param,
+                             ALsizei length,
+                             const ALchar* message,
+                             void* userParam);
+
   void startCaptureOnThread();
   void stopCaptureOnThread();
   std::chrono::milliseconds countExactQueuedMsForLatency(
       std::chrono::time_point<std::chrono::steady_clock> now,
       bool playing);
-  void processRecordingQueued();
+  void processRecordingQueued(std::chrono::microseconds delay);
+
+  // Records all the `_recorders` having the next 10 ms part available, and
+  // returns the time until the next part is expected from any of them.
+  std::chrono::microseconds processRecorders();
+
+  // Updates the smoothed playout delay and the playout statistics with the
+  // latency of the just queued playout buffer.
+  void updatePlayoutDelay(std::chrono::milliseconds latency);
+
+  // Passes the just requested playout samples to the `AudioProcessing`s of all
+  // the `_recorders`, as their echo cancellation reference.
+  void processRenderedSamples();
 
   std::unique_ptr<webrtc::AudioDeviceBuffer> audio_device_buffer_ = nullptr;
 
@@ -222,9 +309,17 @@ class OpenALAudioDeviceModule : public ExtendedADM {
   std::recursive_mutex _recording_mutex;
   bool _recordingInitialized = false;
   bool _microphoneInitialized = false;
-  std::unordered_map<std::string, std::unique_ptr<AudioDeviceRecorder>>
+  std::unordered_map<std::string, std::shared_ptr<AudioDeviceRecorder>>
       _recorders;
 
+  // Indicator whether the `_recorders` have changed since they were last
+  // copied to the `_processedRecorders`.
+  std::atomic<bool> _recordersChanged = false;
+
+  // Copy of the `_recorders` processed by the recording thread without
+  // holding the `_recording_mutex`.
+  std::vector<std::shared_ptr<AudioDeviceRecorder>> _processedRecorders;
+
   std::recursive_mutex _playout_mutex;
   std::string _playoutDeviceId;
   bool _playoutInitialized = false;
@@ -234,6 +329,25 @@ class OpenALAudioDeviceModule : public ExtendedADM {
   std::chrono::milliseconds _playoutLatency = std::chrono::milliseconds(0);
   ALCcontext* _playoutContext = nullptr;
   int _playoutChannels = 2;
+  int _playoutBuffersKeepReady = kBuffersKeepReadyCount;
+
+  // Smoothed latency of the playout device and the OpenAL queue.
+  std::atomic<int> _playoutDelayMs = 0;
+  // Unrounded `_playoutDelayMs`, updated by the playout thread only.
+  double _smoothedPlayoutDelayMs = 0;
+
+  // Smoothed latency of the slowest active `AudioDeviceRecorder`.
+  std::atomic<int> _recordingDelayMs = 0;
+
+  mutable std::mutex _stats_mutex;
+  Stats _stats;
+
+  // `AudioProcessing`s of the `_recorders`, referenced against the playout.
+  std::mutex _render_mutex;
+  std::vector<rtc::scoped_refptr<webrtc::AudioProcessing>> _renderProcessors;
+
+  // Scratch output of `AudioProcessing::ProcessReverseStream()`.
+  std::vector<int16_t> _renderedSamples;
 };
 
 #endif  // BRIDGE_ADM_H_
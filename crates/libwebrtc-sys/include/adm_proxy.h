@@ -9,77 +9,118 @@ namespace webrtc {
 
 using ExtendedADMInterface = ExtendedADM;
 
+// Methods called right on the calling thread, without blocking on the primary
+// one.
+//
+// Only used for the state queries served from a snapshot, and the ones being
+// thread-safe by themselves (e.g. devices enumeration), so the UI never stalls
+// behind media work of the primary thread.
+#define ADM_BYPASS_METHOD0(r, method) \
+  r method() override { return c_->method(); }
+#define ADM_BYPASS_METHOD1(r, method, t1) \
+  r method(t1 a1) override { return c_->method(std::move(a1)); }
+#define ADM_BYPASS_METHOD3(r, method, t1, t2, t3)                  \
+  r method(t1 a1, t2 a2, t3 a3) override {                         \
+    return c_->method(std::move(a1), std::move(a2), std::move(a3)); \
+  }
+#define ADM_BYPASS_CONSTMETHOD0(r, method) \
+  r method() const override { return c_->method(); }
+#define ADM_BYPASS_CONSTMETHOD1(r, method, t1) \
+  r method(t1 a1) const override { return c_->method(std::move(a1)); }
+
 // Define proxy for `AudioDeviceModule`.
+//
+// Mutating methods are marshaled to the primary thread, either blocking on it,
+// or asynchronously via `CallAsync()`.
 BEGIN_PRIMARY_PROXY_MAP(ExtendedADM)
 PROXY_PRIMARY_THREAD_DESTRUCTOR()
-PROXY_CONSTMETHOD1(int32_t, ActiveAudioLayer, AudioDeviceModule::AudioLayer*)
+ADM_BYPASS_CONSTMETHOD1(int32_t,
+                        ActiveAudioLayer,
+                        AudioDeviceModule::AudioLayer*)
 PROXY_METHOD1(int32_t, RegisterAudioCallback, AudioTransport*)
 PROXY_METHOD0(int32_t, Init)
 PROXY_METHOD0(int32_t, Terminate)
-PROXY_CONSTMETHOD0(bool, Initialized)
-PROXY_METHOD1(rtc::scoped_refptr<bridge::LocalAudioSource>,
+ADM_BYPASS_CONSTMETHOD0(bool, Initialized)
+PROXY_METHOD3(rtc::scoped_refptr<bridge::LocalAudioSource>,
               CreateAudioSource,
-              uint32_t)
+              uint32_t,
+              RecordingFormat,
+              cricket::AudioOptions)
 PROXY_METHOD1(void, DisposeAudioSource, std::string)
-PROXY_METHOD0(int16_t, PlayoutDevices)
-PROXY_METHOD0(int16_t, RecordingDevices)
-PROXY_METHOD3(int32_t, PlayoutDeviceName, uint16_t, char*, char*)
-PROXY_METHOD3(int32_t, RecordingDeviceName, uint16_t, char*, char*)
+PROXY_METHOD1(int32_t, SetPlayoutBufferDepth, uint16_t)
+// Posts the `task` to the primary thread instead of blocking on it.
+void CallAsync(absl::AnyInvocable<void(ExtendedADM&) &&> task) override {
+  primary_thread_->PostTask([c = c_, task = std::move(task)]() mutable {
+    std::move(task)(*c);
+  });
+}
+ADM_BYPASS_METHOD0(int16_t, PlayoutDevices)
+ADM_BYPASS_METHOD0(int16_t, RecordingDevices)
+ADM_BYPASS_METHOD3(int32_t, PlayoutDeviceName, uint16_t, char*, char*)
+ADM_BYPASS_METHOD3(int32_t, RecordingDeviceName, uint16_t, char*, char*)
 PROXY_METHOD1(int32_t, SetPlayoutDevice, uint16_t)
 PROXY_METHOD1(int32_t, SetPlayoutDevice, WindowsDeviceType)
 PROXY_METHOD1(int32_t, SetRecordingDevice, uint16_t)
 PROXY_METHOD1(int32_t, SetRecordingDevice, WindowsDeviceType)
-PROXY_METHOD1(int32_t, PlayoutIsAvailable, bool*)
+ADM_BYPASS_METHOD1(int32_t, PlayoutIsAvailable, bool*)
 PROXY_METHOD0(int32_t, InitPlayout)
-PROXY_CONSTMETHOD0(bool, PlayoutIsInitialized)
-PROXY_METHOD1(int32_t, RecordingIsAvailable, bool*)
+ADM_BYPASS_CONSTMETHOD0(bool, PlayoutIsInitialized)
+ADM_BYPASS_METHOD1(int32_t, RecordingIsAvailable, bool*)
 PROXY_METHOD0(int32_t, InitRecording)
-PROXY_CONSTMETHOD0(bool, RecordingIsInitialized)
+ADM_BYPASS_CONSTMETHOD0(bool, RecordingIsInitialized)
 PROXY_METHOD0(int32_t, StartPlayout)
 PROXY_METHOD0(int32_t, StopPlayout)
-PROXY_CONSTMETHOD0(bool, Playing)
+ADM_BYPASS_CONSTMETHOD0(bool, Playing)
 PROXY_METHOD0(int32_t, StartRecording)
 PROXY_METHOD0(int32_t, StopRecording)
-PROXY_CONSTMETHOD0(bool, Recording)
+ADM_BYPASS_CONSTMETHOD0(bool, Recording)
 PROXY_METHOD0(int32_t, InitSpeaker)
-PROXY_CONSTMETHOD0(bool, SpeakerIsInitialized)
+ADM_BYPASS_CONSTMETHOD0(bool, SpeakerIsInitialized)
 PROXY_METHOD0(int32_t, InitMicrophone)
-PROXY_CONSTMETHOD0(bool, MicrophoneIsInitialized)
-PROXY_METHOD1(int32_t, SpeakerVolumeIsAvailable, bool*)
+ADM_BYPASS_CONSTMETHOD0(bool, MicrophoneIsInitialized)
+ADM_BYPASS_METHOD1(int32_t, SpeakerVolumeIsAvailable, bool*)
 PROXY_METHOD1(int32_t, SetSpeakerVolume, uint32_t)
-PROXY_CONSTMETHOD1(int32_t, SpeakerVolume, uint32_t*)
-PROXY_CONSTMETHOD1(int32_t, MaxSpeakerVolume, uint32_t*)
-PROXY_CONSTMETHOD1(int32_t, MinSpeakerVolume, uint32_t*)
-PROXY_METHOD1(int32_t, MicrophoneVolumeIsAvailable, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, SpeakerVolume, uint32_t*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, MaxSpeakerVolume, uint32_t*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, MinSpeakerVolume, uint32_t*)
+ADM_BYPASS_METHOD1(int32_t, MicrophoneVolumeIsAvailable, bool*)
 PROXY_METHOD1(int32_t, SetMicrophoneVolume, uint32_t)
-PROXY_CONSTMETHOD1(int32_t, MicrophoneVolume, uint32_t*)
-PROXY_CONSTMETHOD1(int32_t, MaxMicrophoneVolume, uint32_t*)
-PROXY_CONSTMETHOD1(int32_t, MinMicrophoneVolume, uint32_t*)
-PROXY_METHOD1(int32_t, SpeakerMuteIsAvailable, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, MicrophoneVolume, uint32_t*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, MaxMicrophoneVolume, uint32_t*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, MinMicrophoneVolume, uint32_t*)
+ADM_BYPASS_METHOD1(int32_t, SpeakerMuteIsAvailable, bool*)
 PROXY_METHOD1(int32_t, SetSpeakerMute, bool)
-PROXY_CONSTMETHOD1(int32_t, SpeakerMute, bool*)
-PROXY_METHOD1(int32_t, MicrophoneMuteIsAvailable, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, SpeakerMute, bool*)
+ADM_BYPASS_METHOD1(int32_t, MicrophoneMuteIsAvailable, bool*)
 PROXY_METHOD1(int32_t, SetMicrophoneMute, bool)
-PROXY_CONSTMETHOD1(int32_t, MicrophoneMute, bool*)
-PROXY_CONSTMETHOD1(int32_t, StereoPlayoutIsAvailable, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, MicrophoneMute, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, StereoPlayoutIsAvailable, bool*)
 PROXY_METHOD1(int32_t, SetStereoPlayout, bool)
-PROXY_CONSTMETHOD1(int32_t, StereoPlayout, bool*)
-PROXY_CONSTMETHOD1(int32_t, StereoRecordingIsAvailable, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, StereoPlayout, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, StereoRecordingIsAvailable, bool*)
 PROXY_METHOD1(int32_t, SetStereoRecording, bool)
-PROXY_CONSTMETHOD1(int32_t, StereoRecording, bool*)
-PROXY_CONSTMETHOD1(int32_t, PlayoutDelay, uint16_t*)
-PROXY_CONSTMETHOD0(bool, BuiltInAECIsAvailable)
-PROXY_CONSTMETHOD0(bool, BuiltInAGCIsAvailable)
-PROXY_CONSTMETHOD0(bool, BuiltInNSIsAvailable)
+ADM_BYPASS_CONSTMETHOD1(int32_t, StereoRecording, bool*)
+ADM_BYPASS_CONSTMETHOD1(int32_t, PlayoutDelay, uint16_t*)
+ADM_BYPASS_CONSTMETHOD0(bool, BuiltInAECIsAvailable)
+ADM_BYPASS_CONSTMETHOD0(bool, BuiltInAGCIsAvailable)
+ADM_BYPASS_CONSTMETHOD0(bool, BuiltInNSIsAvailable)
 PROXY_METHOD1(int32_t, EnableBuiltInAEC, bool)
 PROXY_METHOD1(int32_t, EnableBuiltInAGC, bool)
 PROXY_METHOD1(int32_t, EnableBuiltInNS, bool)
-PROXY_CONSTMETHOD0(int32_t, GetPlayoutUnderrunCount)
+ADM_BYPASS_CONSTMETHOD0(int32_t, GetPlayoutUnderrunCount)
+ADM_BYPASS_CONSTMETHOD0(absl::optional<AudioDeviceModule::Stats>, GetStats)
 #if defined(WEBRTC_IOS)
 PROXY_CONSTMETHOD1(int, GetPlayoutAudioParameters, AudioParameters*)
 PROXY_CONSTMETHOD1(int, GetRecordAudioParameters, AudioParameters*)
 #endif  // WEBRTC_IOS
 END_PROXY_MAP(ExtendedADM)
+
+#undef ADM_BYPASS_METHOD0
+#undef ADM_BYPASS_METHOD1
+#undef ADM_BYPASS_METHOD3
+#undef ADM_BYPASS_CONSTMETHOD0
+#undef ADM_BYPASS_CONSTMETHOD1
+
 }  // namespace webrtc
 
 #endif  // BRIDGE_ADM_PROXY_H_
@@ -3,10 +3,15 @@
 
 #include <AL/al.h>
 #include <AL/alc.h>
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 #include "api/media_stream_interface.h"
+#include "common_audio/resampler/include/push_resampler.h"
+#include "libwebrtc-sys/include/drift_compensator.h"
 #include "libwebrtc-sys/include/local_audio_source.h"
+#include "modules/audio_processing/include/audio_processing.h"
 #include "rtc_base/thread.h"
 
 constexpr auto kPlayoutFrequency = 48000;
@@ -14,26 +19,105 @@ constexpr auto kRecordingFrequency = 48000;
 constexpr auto kRecordingChannels = 1;
 constexpr std::int64_t kBufferSizeMs = 10;
 constexpr auto kProcessInterval = 10;
+// Minimal interval between processing the recorded audio, in milliseconds.
+constexpr auto kMinProcessInterval = 1;
 constexpr auto kALMaxValues = 6;
 constexpr auto kQueryExactTimeEach = 20;
-constexpr auto kDefaultPlayoutLatency = std::chrono::duration<double>(20.0);
+constexpr auto kDefaultPlayoutLatency =
+    std::chrono::duration<double, std::milli>(20.0);
 constexpr auto kDefaultRecordingLatency = std::chrono::milliseconds(20);
+// Weight of a new measurement in smoothed latencies.
+constexpr auto kLatencySmoothingFactor = 0.125;
 constexpr auto kRestartAfterEmptyData = 50;  // Half a second with no data.
 constexpr auto kPlayoutPart = (kPlayoutFrequency * kBufferSizeMs + 999) / 1000;
-constexpr auto kBuffersFullCount = 7;
+// Default number of `kPlayoutPart` buffers kept queued for playout.
 constexpr auto kBuffersKeepReadyCount = 5;
+// Limits of the number of `kPlayoutPart` buffers kept queued for playout.
+constexpr auto kMinBuffersKeepReadyCount = 2;
+constexpr auto kMaxBuffersKeepReadyCount = 50;
+// Number of playout buffers allocated in addition to the ones kept queued.
+constexpr auto kBuffersSpareCount = 2;
 constexpr auto kRecordingPart =
     (kRecordingFrequency * kBufferSizeMs + 999) / 1000;
+// Maximum number of 10 ms parts recorded from a single device per processing
+// cycle, so a device with a backlog doesn't delay the others.
+constexpr auto kMaxRecordedPartsPerCycle = 4;
+// Limits of the sample rate audio devices may be recorded with.
+constexpr auto kMinRecordingFrequency = 8000;
+constexpr auto kMaxRecordingFrequency = 48000;
+constexpr auto kMaxRecordingChannels = 2;
+// Default size of the OpenAL capture ring, in milliseconds.
+constexpr auto kDefaultRecordingRingSizeMs = 1000;
+// Limits of the size of the OpenAL capture ring, in milliseconds.
+constexpr auto kMinRecordingRingSizeMs = 2 * kBufferSizeMs;
+constexpr auto kMaxRecordingRingSizeMs = 10000;
+
+// Format of the audio samples recorded from an audio device.
+enum class RecordingSampleFormat { kInt16, kFloat32 };
+
+// Parameters of the audio recording from an audio device.
+struct RecordingFormat {
+  // Sample rate the device is recorded with, in Hz.
+  int sampleRate = kRecordingFrequency;
+
+  // Number of the recorded channels.
+  int channels = kRecordingChannels;
+
+  // Format of the samples the device is recorded with.
+  RecordingSampleFormat sampleFormat = RecordingSampleFormat::kInt16;
+
+  // Size of the OpenAL capture ring, in milliseconds.
+  int ringSizeMs = kDefaultRecordingRingSizeMs;
+
+  // Indicates whether this `RecordingFormat` is within the supported limits.
+  //
+  // The sample rate must be a multiple of 100 Hz, so that 10 ms parts consist
+  // of whole sample frames, as the resampling requires.
+  bool IsValid() const {
+    return sampleRate >= kMinRecordingFrequency &&
+           sampleRate <= kMaxRecordingFrequency && sampleRate % 100 == 0 &&
+           channels >= 1 &&
+           channels <= kMaxRecordingChannels &&
+           ringSizeMs >= kMinRecordingRingSizeMs &&
+           ringSizeMs <= kMaxRecordingRingSizeMs;
+  }
+};
 
 // Audio recording from an audio device and propagation of the recorded audio
 // data to a `bridge::LocalAudioSource`.
+//
+// The recorded audio is processed by an `AudioProcessing` of its own (echo
+// cancellation, noise suppression and gain control, as enabled by the provided
+// `AudioOptions`), so every device is processed exactly once, regardless of the
+// number of recorders.
+//
+// The device is recorded in the provided `RecordingFormat`, and the recorded
+// audio is converted into 10 ms frames of 16-bit samples, resampled to the
+// closest rate natively supported by the `AudioProcessing`, if required.
+//
+// The device clock is tracked against the monotonic one, and the drift between
+// them is compensated by a `DriftCompensator`, so audio of multiple devices
+// recorded at once never slides apart.
 class AudioDeviceRecorder {
  public:
-  AudioDeviceRecorder(std::string deviceId);
+  // Creates a new `AudioDeviceRecorder` recording the device with the provided
+  // ID in the provided `RecordingFormat`, and processing the recorded audio
+  // according to the provided `AudioOptions`.
+  AudioDeviceRecorder(std::string deviceId,
+                      RecordingFormat format,
+                      cricket::AudioOptions options);
+
+  // Captures a new batch of audio samples, processes it and propagates it to
+  // the inner `bridge::LocalAudioSource`.
+  //
+  // `playoutDelay` is the current latency of the audio playout, which the
+  // echo canceller needs to align the playout audio with the recorded one.
+  bool ProcessRecordedPart(bool firstInCycle,
+                           std::chrono::milliseconds playoutDelay);
 
-  // Captures a new batch of audio samples and propagates it to the inner
-  // `bridge::LocalAudioSource`.
-  bool ProcessRecordedPart(bool firstInCycle);
+  // Returns the time until the device is expected to have the next 10 ms part
+  // recorded, as of the last `ProcessRecordedPart()` call.
+  std::chrono::microseconds NextPartDelay() const;
 
   // Stops audio capture freeing the captured device.
   void StopCapture();
@@ -45,23 +129,56 @@ class AudioDeviceRecorder {
   // writes the recorded audio to.
   rtc::scoped_refptr<bridge::LocalAudioSource> GetSource();
 
+  // Returns the smoothed latency between capturing audio by the device and
+  // propagating it to the `bridge::LocalAudioSource`.
+  std::chrono::milliseconds Latency() const;
+
+  // Returns the `AudioProcessing` of this `AudioDeviceRecorder`.
+  //
+  // The audio being played out should be passed to its
+  // `ProcessReverseStream()`, as the echo cancellation reference.
+  rtc::scoped_refptr<webrtc::AudioProcessing> GetAudioProcessing();
+
  private:
   void openRecordingDevice();
   bool checkDeviceFailed();
   void closeRecordingDevice();
   void restartRecording();
   bool validateRecordingDeviceId();
+  void updateLatency(ALint queuedSamples);
+  void convertRecordedSamples();
+  void processRecordedSamples(std::chrono::milliseconds playoutDelay);
+  void emitCompensatedSamples(std::chrono::milliseconds playoutDelay);
 
   rtc::scoped_refptr<bridge::LocalAudioSource> _source;
+  rtc::scoped_refptr<webrtc::AudioProcessing> _audioProcessing;
   ALCdevice* _device;
   std::string _deviceId;
   std::recursive_mutex _mutex;
   bool _recordingFailed = false;
   bool _recording = false;
-  int _recordBufferSize = kRecordingPart * sizeof(int16_t) * kRecordingChannels;
-  std::vector<char>* _recordedSamples =
-      new std::vector<char>(_recordBufferSize, 0);
+  RecordingFormat _format;
+  // Number of sample frames recorded from the device per 10 ms.
+  int _recordingPart = 0;
+  // Sample rate of the audio propagated to the `_source`.
+  int _outputFrequency = 0;
+  // Samples in the device format, if they require conversion.
+  std::vector<char> _capturedSamples;
+  // Converted `kFloat32` samples, if they require resampling.
+  std::vector<int16_t> _convertedSamples;
+  // Samples of the last recorded 10 ms, converted to the `_outputFrequency`.
+  std::vector<int16_t> _recordedSamples;
+  webrtc::PushResampler<int16_t> _resampler;
+  std::unique_ptr<DriftCompensator> _driftCompensator;
+  // Samples of the last 10 ms propagated to the `_source`.
+  std::vector<int16_t> _compensatedSamples;
+  // Total number of sample frames recorded since the device has been opened.
+  int64_t _recordedFrames = 0;
+  std::chrono::microseconds _nextPartDelay = std::chrono::microseconds(0);
   int _emptyRecordingData = 0;
+  std::atomic<int> _latencyMs = 0;
+  // Unrounded `_latencyMs`, updated by the recording thread only.
+  double _smoothedLatencyMs = 0;
 };
 
 #endif  // BRIDGE_AUDIO_DEVICE_RECORDER_H_
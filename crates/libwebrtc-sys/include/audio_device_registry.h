@@ -0,0 +1,49 @@
+#ifndef BRIDGE_AUDIO_DEVICE_REGISTRY_H_
+#define BRIDGE_AUDIO_DEVICE_REGISTRY_H_
+
+#include <AL/al.h>
+#include <AL/alc.h>
+#include <string>
+
+// Process-wide cache of the OpenAL audio devices lists.
+//
+// Parsing the `alcGetString()` lists on every query makes walking all the
+// devices quadratic, and takes the OpenAL enumeration lock each time. Instead,
+// the lists are parsed once and indexed both by position and by GUID, until
+// the devices are reported to be changed via `Invalidate()`.
+//
+// While no hot-plug notifications are delivered (see `EnableCaching()`), the
+// lists are re-parsed on every query, so new devices are never missed.
+//
+// Thread-safe.
+class AudioDeviceRegistry {
+ public:
+  // Enables caching of the parsed lists, once somebody is going to call
+  // `Invalidate()` on every devices change.
+  static void EnableCaching();
+
+  // Disables caching of the parsed lists, once nobody calls `Invalidate()` on
+  // devices changes anymore.
+  static void DisableCaching();
+
+  // Drops the cached lists, so they're re-parsed on the next query.
+  static void Invalidate();
+
+  // Returns the number of devices of the provided OpenAL `specifier`.
+  static int Count(ALCenum specifier);
+
+  // Writes the name and GUID of the device with the provided `index` of the
+  // provided OpenAL `specifier` list.
+  //
+  // Returns `false` if there is no such device.
+  static bool Get(ALCenum specifier,
+                  int index,
+                  std::string* name,
+                  std::string* guid);
+
+  // Indicates whether the device with the provided `guid` is present in the
+  // list of the provided OpenAL `specifier`.
+  static bool Contains(ALCenum specifier, const std::string& guid);
+};
+
+#endif  // BRIDGE_AUDIO_DEVICE_REGISTRY_H_
@@ -24,13 +24,17 @@
 #include "pc/video_track_source.h"
 #include "peer_connection.h"
 #include "rust/cxx.h"
+#include "fake_video_source.h"
+#include "i420_buffer_pool.h"
 #include "screen_video_capturer.h"
+#include "synthetic_audio_source.h"
+#include "video_codec_factory.h"
 #include "video_sink.h"
 
 #include "adm.h"
 #include "adm_proxy.h"
+#include "audio_device_registry.h"
 
-#include "media/base/fake_frame_source.h"
 #include "modules/audio_device/include/test_audio_device.h"
 #include "pc/test/fake_video_track_source.h"
 
@@ -61,6 +65,14 @@ class TrackEventObserver : public webrtc::ObserverInterface {
 struct TransceiverContainer;
 struct DisplaySourceContainer;
 struct StringPair;
+struct VideoSinkWants;
+struct I420BufferPoolStats;
+struct AudioCaptureFormat;
+struct AudioProcessingOptions;
+enum class FakeVideoContent : uint8_t;
+struct FakeAudioOptions;
+struct VideoCodecConfig;
+struct DynAudioDeviceModuleCallback;
 struct RtpCodecParametersContainer;
 struct RtpExtensionContainer;
 struct RtpEncodingParametersContainer;
@@ -179,6 +191,24 @@ int32_t start_playout(const AudioDeviceModule& audio_device_module);
 int32_t set_audio_playout_device(const AudioDeviceModule& audio_device_module,
                                  uint16_t index);
 
+// Sets the number of 10 ms buffers kept queued for playout by the specified
+// `AudioDeviceModule`.
+int32_t set_playout_buffer_depth(const AudioDeviceModule& audio_device_module,
+                                 uint16_t buffers);
+
+// Asynchronously specifies which device to use for playout audio, passing the
+// result to the provided callback.
+void set_audio_playout_device_async(
+    const AudioDeviceModule& audio_device_module,
+    uint16_t index,
+    rust::Box<DynAudioDeviceModuleCallback> cb);
+
+// Asynchronously sets the microphone volume level, passing the result to the
+// provided callback.
+void set_microphone_volume_async(const AudioDeviceModule& audio_device_module,
+                                 uint32_t volume,
+                                 rust::Box<DynAudioDeviceModuleCallback> cb);
+
 // Creates a new `AudioProcessing`.
 std::unique_ptr<AudioProcessing> create_audio_processing();
 
@@ -218,36 +248,63 @@ std::unique_ptr<VideoTrackSourceInterface> create_device_video_source(
     size_t fps,
     uint32_t device_index);
 
-// Creates a new fake `DeviceVideoCapturer` with the specified constraints and
-// calls `CreateVideoTrackSourceProxy()`.
+// Creates a new `FakeVideoSource` with the specified constraints and calls
+// `CreateVideoTrackSourceProxy()`.
 std::unique_ptr<VideoTrackSourceInterface> create_fake_device_video_source(
     Thread& worker_thread,
     Thread& signaling_thread,
     size_t width,
     size_t height,
-    size_t fps);
+    size_t fps,
+    FakeVideoContent content,
+    bool counter_overlay);
 
 // Starts screen capturing and creates a new `VideoTrackSourceInterface`
-// according to the specified constraints.
+// according to the specified constraints, spending at most
+// `cpu_budget_percentage` of a CPU core on capturing.
 std::unique_ptr<VideoTrackSourceInterface> create_display_video_source(
     Thread& worker_thread,
     Thread& signaling_thread,
     int64_t id,
     size_t width,
     size_t height,
-    size_t fps);
+    size_t fps,
+    uint8_t cpu_budget_percentage);
+
+// Returns the counters of the `I420BufferPool`s of all the screen capturers and
+// fake video sources.
+I420BufferPoolStats i420_buffer_pool_stats();
+
+// Sets the maximum number of `I420Buffer`s kept by every `I420BufferPool`.
+void set_i420_buffer_pool_depth(size_t depth);
+
+// Enables caching of the enumerated audio devices until they're invalidated.
+void enable_audio_device_cache();
+
+// Disables caching of the enumerated audio devices, so they're re-enumerated on
+// every query.
+void disable_audio_device_cache();
+
+// Drops the cached audio devices, so they're re-enumerated on the next query.
+void invalidate_audio_device_cache();
 
-// Creates a new `AudioSourceInterface`.
+// Creates a new `AudioSourceInterface` recording the device with the provided
+// index in the provided `AudioCaptureFormat`, and processing the recorded audio
+// according to the provided `AudioProcessingOptions`.
 std::unique_ptr<AudioSourceInterface> create_audio_source(
     const AudioDeviceModule& audio_device_module,
-    uint16_t device_index);
+    uint16_t device_index,
+    AudioCaptureFormat format,
+    AudioProcessingOptions processing);
 
 // Disposes the `AudioSourceInterface` with the provided device ID.
 void dispose_audio_source(const AudioDeviceModule& audio_device_module,
                           rust::String device_id);
 
-// Creates a new fake `AudioSourceInterface`.
-std::unique_ptr<AudioSourceInterface> create_fake_audio_source();
+// Creates a new fake `AudioSourceInterface` producing the signal of the
+// provided `FakeAudioOptions`.
+std::unique_ptr<AudioSourceInterface> create_fake_audio_source(
+    const FakeAudioOptions& options);
 
 // Creates a new `VideoTrackInterface`.
 std::unique_ptr<VideoTrackInterface> create_video_track(
@@ -302,7 +359,8 @@ TrackState audio_track_state(const AudioTrackInterface& track);
 //
 // Used to connect the given `track` to the underlying video engine.
 void add_or_update_video_sink(const VideoTrackInterface& track,
-                              VideoSinkInterface& sink);
+                              VideoSinkInterface& sink,
+                              const VideoSinkWants& wants);
 
 // Detaches the provided video `sink` from the given `track`.
 void remove_video_sink(const VideoTrackInterface& track,
@@ -322,13 +380,39 @@ void video_frame_to_argb(const webrtc::VideoFrame& frame,
                          int argb_stride,
                          uint8_t* dst_argb);
 
-// Creates a new `PeerConnectionFactoryInterface`.
+// Converts the provided `webrtc::VideoFrame` pixels to the ABGR scheme, scaled
+// to `dst_width`x`dst_height` and rotated if `apply_rotation` is set, and
+// writes the result to the provided `dst_abgr` with the `dst_stride`.
+void video_frame_to_abgr_scaled(const webrtc::VideoFrame& frame,
+                                int dst_width,
+                                int dst_height,
+                                int dst_stride,
+                                bool apply_rotation,
+                                uint8_t* dst_abgr);
+
+// Creates a new `webrtc::VideoFrame` sharing the pixel buffer of the provided
+// `frame`.
+std::unique_ptr<webrtc::VideoFrame> clone_video_frame(
+    const webrtc::VideoFrame& frame);
+
+// Makes the provided `dst` frame share the pixel buffer and metadata of the
+// provided `src` frame, reusing the `dst` allocation.
+void assign_video_frame(webrtc::VideoFrame& dst,
+                        const webrtc::VideoFrame& src);
+
+// Releases the pixel buffer referenced by the provided `frame`, so it can be
+// reused by its producer while the `frame` allocation itself is kept.
+void release_video_frame_buffer(webrtc::VideoFrame& frame);
+
+// Creates a new `PeerConnectionFactoryInterface` with the provided
+// `VideoCodecConfig`.
 std::unique_ptr<PeerConnectionFactoryInterface> create_peer_connection_factory(
     const std::unique_ptr<Thread>& network_thread,
     const std::unique_ptr<Thread>& worker_thread,
     const std::unique_ptr<Thread>& signaling_thread,
     const std::unique_ptr<AudioDeviceModule>& default_adm,
-    const std::unique_ptr<AudioProcessing>& ap);
+    const std::unique_ptr<AudioProcessing>& ap,
+    const VideoCodecConfig& video_codecs);
 
 // Creates a new `PeerConnectionInterface`.
 std::unique_ptr<PeerConnectionInterface> create_peer_connection_or_error(
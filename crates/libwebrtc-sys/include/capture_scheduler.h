@@ -0,0 +1,49 @@
+#ifndef BRIDGE_CAPTURE_SCHEDULER_H_
+#define BRIDGE_CAPTURE_SCHEDULER_H_
+
+#include <cstdint>
+
+// Deadline-based pacing of periodic frame captures.
+//
+// Captures are scheduled on a monotonic grid of deadlines, so the time spent on
+// a capture doesn't shift the following ones, and there is no jitter
+// accumulating between frames. The capture interval adapts to:
+// - the target framerate of the capturer;
+// - the maximum framerate requested by the sinks (e.g. an overusing encoder);
+// - the measured cost of a capture, so it never exceeds the CPU budget.
+class CaptureScheduler {
+ public:
+  // Creates a new `CaptureScheduler` targeting the provided framerate and
+  // spending at most `cpu_budget_percentage` of a CPU core on captures.
+  CaptureScheduler(int target_fps, int cpu_budget_percentage);
+
+  // Returns the monotonic time of the next capture in microseconds.
+  int64_t NextCaptureTimeUs(int64_t now_us);
+
+  // Records the cost of the capture started at the last returned deadline.
+  void OnCaptureDone(int64_t cost_us);
+
+  // Sets the maximum framerate requested by the sinks of the captured frames.
+  void SetMaxFramerate(int max_fps);
+
+  // Returns the current capture interval in microseconds.
+  int64_t interval_us() const;
+
+ private:
+  // Minimal interval between captures of the target framerate.
+  const int64_t target_interval_us_;
+
+  // Maximum share of a CPU core to spend on captures, in percents.
+  const int cpu_budget_percentage_;
+
+  // Minimal interval between captures requested by the sinks.
+  int64_t sink_interval_us_ = 0;
+
+  // Exponentially weighted average cost of a single capture.
+  int64_t average_cost_us_ = 0;
+
+  // Deadline of the next capture, or `0` if none has been scheduled yet.
+  int64_t next_capture_us_ = 0;
+};
+
+#endif  // BRIDGE_CAPTURE_SCHEDULER_H_
@@ -0,0 +1,94 @@
+#ifndef BRIDGE_DRIFT_COMPENSATOR_H_
+#define BRIDGE_DRIFT_COMPENSATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Maximum deviation of an audio device clock from its nominal sample rate
+// being compensated, as a ratio.
+//
+// Sound cards are specified to be within hundreds of ppm, so anything beyond
+// `0.5%` is a measurement glitch rather than a drift.
+const double kMaxClockDriftRatio = 0.005;
+
+// Maximum number of 10 ms frames buffered by a `DriftCompensator`, bounding
+// the latency it may add.
+const int kMaxDriftBufferedFrames = 4;
+
+// Compensation of an audio device clock drifting against the monotonic clock.
+//
+// Tracks the rate the device actually produces samples at, and adaptively
+// resamples its audio, so exactly the nominal number of samples per second of
+// the monotonic clock is produced, regardless of the device clock skew. Audio
+// of multiple devices recorded this way stays aligned indefinitely.
+//
+// The drift is tiny, so linear interpolation is enough to resample the audio
+// without audible artifacts.
+class DriftCompensator {
+ public:
+  // Creates a new `DriftCompensator` of the audio recorded from a device with
+  // the provided nominal sample rate, producing 10 ms frames of the provided
+  // number of samples per channel.
+  DriftCompensator(int device_sample_rate,
+                   size_t frame_samples,
+                   size_t channels);
+
+  // Restarts the device clock tracking and drops all the buffered samples,
+  // e.g. once the device is reopened.
+  void Reset();
+
+  // Records that the device has produced `device_samples` per channel in total
+  // by the monotonic time `now_us`.
+  void UpdateClock(int64_t now_us, int64_t device_samples);
+
+  // Appends the provided interleaved samples to the buffered ones.
+  //
+  // Drops the oldest buffered samples exceeding `kMaxDriftBufferedFrames`.
+  void Push(const int16_t* samples, size_t samples_per_channel);
+
+  // Writes the next 10 ms frame of the compensated audio into the provided
+  // `frame`, if enough samples are buffered.
+  bool Pop(int16_t* frame);
+
+  // Returns the duration of the buffered samples in milliseconds.
+  int64_t buffered_ms() const;
+
+ private:
+  // Returns the number of the buffered samples per channel.
+  size_t buffered_samples() const;
+
+  // Returns the number of the buffered samples per channel consumed per one
+  // produced sample.
+  double Step() const;
+
+  // Nominal sample rate of the device.
+  const int device_sample_rate_;
+
+  // Number of samples per channel in a single 10 ms frame.
+  const size_t frame_samples_;
+
+  // Number of interleaved channels.
+  const size_t channels_;
+
+  // Monotonic time and number of device samples the clock is measured since.
+  int64_t anchor_us_ = 0;
+  int64_t anchor_samples_ = 0;
+
+  // Monotonic time the clock tracking has been started at.
+  int64_t start_us_ = 0;
+
+  // Measured ratio of the device clock to the monotonic one.
+  double clock_ratio_ = 1.0;
+
+  // Exponentially weighted average of the samples buffered before a `Pop()`.
+  double average_fill_ = 0;
+
+  // Buffered interleaved samples.
+  std::vector<int16_t> buffer_;
+
+  // Fractional position of the next sample to interpolate in the `buffer_`.
+  double position_ = 0;
+};
+
+#endif  // BRIDGE_DRIFT_COMPENSATOR_H_
@@ -0,0 +1,94 @@
+#ifndef BRIDGE_FAKE_VIDEO_SOURCE_H_
+#define BRIDGE_FAKE_VIDEO_SOURCE_H_
+
+#include <cstdint>
+
+#include "api/video/i420_buffer.h"
+#include "i420_buffer_pool.h"
+#include "media/base/adapted_video_track_source.h"
+
+// Content of the frames produced by a `FakeVideoSource`.
+enum class FakeFrameContent {
+  // Black frames.
+  kBlack,
+
+  // Diagonal color gradient moving with every frame.
+  kGradient,
+
+  // Pseudo-random noise seeded by the frame number, so it's repeatable
+  // between runs.
+  kNoise,
+};
+
+// Number of bits of each row of the counter overlay.
+const int kCounterOverlayBits = 64;
+
+// `VideoTrackSourceInterface` producing synthetic frames.
+//
+// Frames are produced by a single pacing thread shared by all the
+// `FakeVideoSource`s, on a monotonic grid of absolute deadlines, so the time
+// spent on producing a frame never makes the framerate drift. Producing stops
+// once the `FakeVideoSource` is destroyed along with its track.
+//
+// The optional counter overlay encodes the frame number and its capture time
+// in the top-left corner, so the frames can be identified on the receiving
+// side (e.g. to measure the end-to-end latency). Each of them is drawn as a
+// row of `kCounterOverlayBits` black (`0`) and white (`1`) square cells, the
+// most significant bit first.
+class FakeVideoSource : public rtc::AdaptedVideoTrackSource {
+ public:
+  // Creates a new `FakeVideoSource` producing frames of the provided size and
+  // content at the provided framerate.
+  FakeVideoSource(int width,
+                  int height,
+                  int fps,
+                  FakeFrameContent content,
+                  bool counter_overlay);
+  ~FakeVideoSource() override;
+
+  // Produces a new frame captured at the provided monotonic time.
+  //
+  // Must only be called by the pacing thread.
+  void ProduceFrame(int64_t capture_time_us);
+
+  // Returns the interval between the produced frames in microseconds.
+  int64_t interval_us() const;
+
+ private:
+  // Fills the provided `buffer` with the `content_` of the current frame.
+  void DrawContent(webrtc::I420Buffer* buffer);
+
+  // Draws the counter overlay of the current frame into the provided
+  // `buffer`.
+  void DrawCounter(webrtc::I420Buffer* buffer, int64_t capture_time_us);
+
+  // `VideoTrackSourceInterface` implementation.
+  bool is_screencast() const override;
+  absl::optional<bool> needs_denoising() const override;
+  webrtc::MediaSourceInterface::SourceState state() const override;
+  bool remote() const override;
+
+  // Size of the produced frames, unless adapted to the sinks.
+  const int width_;
+  const int height_;
+
+  // Interval between the produced frames.
+  const int64_t interval_us_;
+
+  // Content of the produced frames.
+  const FakeFrameContent content_;
+
+  // Indicator whether the counter overlay is drawn.
+  const bool counter_overlay_;
+
+  // Number of the next produced frame.
+  uint64_t frame_number_ = 0;
+
+  // Pool of the `I420Buffer`s the frames are drawn into.
+  I420BufferPool buffer_pool_;
+
+  // ID of this `FakeVideoSource` in the pacing thread.
+  uint64_t pacer_id_ = 0;
+};
+
+#endif  // BRIDGE_FAKE_VIDEO_SOURCE_H_
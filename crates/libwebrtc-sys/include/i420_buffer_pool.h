@@ -0,0 +1,60 @@
+#ifndef BRIDGE_I420_BUFFER_POOL_H_
+#define BRIDGE_I420_BUFFER_POOL_H_
+
+#include <atomic>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/i420_buffer.h"
+
+// Default maximum number of `I420Buffer`s kept by an `I420BufferPool`.
+const size_t kDefaultI420BufferPoolDepth = 8;
+
+// Pool recycling `I420Buffer`s of a single video producer.
+//
+// Buffers are handed out as long as somebody references them (e.g. an encoder
+// or a sink), and are reused once they are released. Unlike
+// `webrtc::VideoFrameBufferPool`, it never fails to provide a buffer: when all
+// the pooled buffers are in use, a new unpooled one is allocated.
+//
+// Not thread-safe, so must only be used by a single producer thread.
+class I420BufferPool {
+ public:
+  // Creates a new `I420BufferPool` keeping up to the global `depth()` buffers.
+  I420BufferPool() = default;
+
+  I420BufferPool(const I420BufferPool&) = delete;
+  I420BufferPool& operator=(const I420BufferPool&) = delete;
+
+  // Returns an `I420Buffer` of the provided size not referenced by anyone else.
+  //
+  // Contents of a reused buffer are the ones of its previous frame. Newly
+  // allocated buffers are black.
+  rtc::scoped_refptr<webrtc::I420Buffer> Acquire(int width, int height);
+
+  // Indicates whether the provided `buffer` is referenced by nobody but this
+  // pool and the caller, so it can be safely written to.
+  bool IsExclusive(const rtc::scoped_refptr<webrtc::I420Buffer>& buffer);
+
+  // Returns the maximum number of buffers kept by every `I420BufferPool`.
+  static size_t depth();
+
+  // Sets the maximum number of buffers kept by every `I420BufferPool`.
+  //
+  // Pools exceeding the new depth release their idle buffers on their next
+  // `Acquire()` call.
+  static void set_depth(size_t depth);
+
+  // Returns the total number of buffers reused by all the `I420BufferPool`s.
+  static uint64_t hits();
+
+  // Returns the total number of buffers allocated by all the
+  // `I420BufferPool`s.
+  static uint64_t misses();
+
+ private:
+  // Buffers owned by this pool.
+  std::vector<rtc::scoped_refptr<webrtc::I420Buffer>> buffers_;
+};
+
+#endif  // BRIDGE_I420_BUFFER_POOL_H_
@@ -1,7 +1,10 @@
 #ifndef BRIDGE_LOCAL_AUDIO_SOURCE_H_
 #define BRIDGE_LOCAL_AUDIO_SOURCE_H_
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "api/audio_options.h"
 #include "api/media_stream_interface.h"
@@ -12,6 +15,9 @@ namespace bridge {
 
 // Implementation of an `AudioSourceInterface` with settings for switching audio
 // processing on and off.
+//
+// Sinks are stored in an immutable list replaced on every change (RCU-style),
+// so propagating audio data never blocks on the sinks being added or removed.
 class LocalAudioSource : public webrtc::Notifier<webrtc::AudioSourceInterface> {
  public:
   // Creates a new `LocalAudioSource`.
@@ -24,22 +30,51 @@ class LocalAudioSource : public webrtc::Notifier<webrtc::AudioSourceInterface> {
   const cricket::AudioOptions options() const override { return _options; }
 
   void AddSink(webrtc::AudioTrackSinkInterface* sink) override;
+
+  // Removes the provided sink.
+  //
+  // Once this returns, the sink is guaranteed not to receive audio data
+  // anymore, unless it's called from the `OnData()` of a sink itself.
   void RemoveSink(webrtc::AudioTrackSinkInterface* sink) override;
 
+  // Propagates the provided audio data to all the added sinks.
+  //
+  // Never blocks, so it's safe to call from a real-time audio thread.
+  //
+  // `absolute_capture_timestamp_ms` is the time the first sample was captured
+  // by the device, in the `rtc::TimeMillis()` clock.
   void OnData(const void* audio_data,
               int bits_per_sample,
               int sample_rate,
               size_t number_of_channels,
-              size_t number_of_frames);
+              size_t number_of_frames,
+              absl::optional<int64_t> absolute_capture_timestamp_ms);
 
  protected:
-  LocalAudioSource() {}
-  ~LocalAudioSource() override {}
+  LocalAudioSource();
+  ~LocalAudioSource() override;
 
  private:
+  using SinkList = std::vector<webrtc::AudioTrackSinkInterface*>;
+
+  // Replaces the `sinks_` with the provided ones, waiting until no `OnData()`
+  // call uses the previous ones.
+  void PublishSinks(std::unique_ptr<SinkList> sinks);
+
   cricket::AudioOptions _options;
-  std::recursive_mutex sink_lock_;
-  std::list<webrtc::AudioTrackSinkInterface*> sinks_;
+
+  // Mutex serializing the changes of the `sinks_`, never taken by `OnData()`.
+  std::mutex sinks_mutex_;
+
+  // Current immutable list of the sinks.
+  std::atomic<const SinkList*> sinks_;
+
+  // Number of the `OnData()` calls in progress.
+  std::atomic<int> dispatching_ = 0;
+
+  // Lists of the sinks replaced from inside an `OnData()` call, which are
+  // freed once it completes.
+  std::vector<std::unique_ptr<const SinkList>> retired_sinks_;
 };
 
 }  // namespace bridge
@@ -2,6 +2,7 @@
 #define BRIDGE_PEER_CONNECTION_H_
 
 #include <functional>
+#include <mutex>
 #include <optional>
 
 #include "api/peer_connection_interface.h"
@@ -157,6 +158,34 @@ class RTCStatsCollectorCallback
   std::optional<rust::Box<bridge::DynRTCStatsCollectorCallback>> cb_;
 };
 
+// `RTCStatsCollectorCallback` merging the reports of multiple selector-based
+// `GetStats()` calls into a single one propagated to the Rust side.
+class MergingStatsCollectorCallback
+    : public rtc::RefCountedObject<webrtc::RTCStatsCollectorCallback> {
+ public:
+  MergingStatsCollectorCallback(
+      size_t expected,
+      uint32_t type_mask,
+      rust::Box<bridge::DynRTCStatsCollectorCallback> cb);
+  void OnStatsDelivered(const RTCStatsReport& report);
+
+ private:
+  // Mutex guarding the fields below.
+  std::mutex mutex_;
+
+  // Number of the reports yet to be delivered.
+  size_t pending_;
+
+  // Mask of the `RTCStatsType`s to be merged.
+  uint32_t type_mask_;
+
+  // Report merging all the delivered ones.
+  rtc::scoped_refptr<webrtc::RTCStatsReport> merged_;
+
+  // Rust side callback.
+  std::optional<rust::Box<bridge::DynRTCStatsCollectorCallback>> cb_;
+};
+
 // `SetLocalDescriptionObserverInterface` propagating completion result to the
 // Rust side.
 class SetLocalDescriptionObserver
@@ -239,6 +268,16 @@ void close_peer_connection(const PeerConnectionInterface& peer);
 void peer_connection_get_stats(const PeerConnectionInterface& peer,
                                rust::Box<DynRTCStatsCollectorCallback> cb);
 
+// Calls the selector-based `PeerConnectionInterface->GetStats` for the senders
+// and receivers of the tracks and transceivers (by their `mid`s) with the
+// provided IDs, merging the stats of the `RTCStatsType`s in the provided
+// `type_mask` of their reports into a single one.
+void peer_connection_get_selected_stats(
+    const PeerConnectionInterface& peer,
+    const rust::Vec<rust::String>& ids,
+    uint32_t type_mask,
+    rust::Box<DynRTCStatsCollectorCallback> cb);
+
 }  // namespace bridge
 
 #endif // BRIDGE_PEER_CONNECTION_H_
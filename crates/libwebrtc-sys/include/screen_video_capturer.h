@@ -19,6 +19,9 @@
 #ifndef BRIDGE_SCREEN_VIDEO_CAPTURER_H_
 #define BRIDGE_SCREEN_VIDEO_CAPTURER_H_
 
+#include "api/video/i420_buffer.h"
+#include "capture_scheduler.h"
+#include "i420_buffer_pool.h"
 #include "media/base/adapted_video_track_source.h"
 #include "modules/desktop_capture/desktop_and_cursor_composer.h"
 #include "modules/desktop_capture/desktop_capturer.h"
@@ -26,6 +29,7 @@
 #include "modules/desktop_capture/mouse_cursor.h"
 #include "modules/desktop_capture/mouse_cursor_monitor.h"
 #include "modules/video_capture/video_capture.h"
+#include "rtc_base/event.h"
 #include "rtc_base/platform_thread.h"
 
 // `VideoTrackSourceInterface` capturing frames from a user's display.
@@ -38,11 +42,13 @@ class ScreenVideoCapturer : public rtc::AdaptedVideoTrackSource,
   // used by this `ScreenVideoCapturer`.
   static bool GetSourceList(webrtc::DesktopCapturer::SourceList* sources);
 
-  // Creates a new `ScreenVideoCapturer` with the specified constraints.
+  // Creates a new `ScreenVideoCapturer` with the specified constraints,
+  // spending at most `cpu_budget_percentage` of a CPU core on capturing.
   ScreenVideoCapturer(webrtc::DesktopCapturer::SourceId source_id,
                       size_t max_width,
                       size_t max_height,
-                      size_t target_fps);
+                      size_t target_fps,
+                      int cpu_budget_percentage);
   ~ScreenVideoCapturer();
 
   // `MouseCursorMonitor::Callback` interface.
@@ -50,7 +56,10 @@ class ScreenVideoCapturer : public rtc::AdaptedVideoTrackSource,
   void OnMouseCursorPosition(const webrtc::DesktopVector& position) override;
 
  private:
-  // Captures a `webrtc::DesktopFrame`.
+  // Waits for the next deadline of the `scheduler_` and captures a
+  // `webrtc::DesktopFrame`.
+  //
+  // Returns `false` once this `ScreenVideoCapturer` is stopped.
   bool CaptureProcess();
 
   // Callback for `webrtc::DesktopCapturer::CaptureFrame`.
@@ -60,6 +69,24 @@ class ScreenVideoCapturer : public rtc::AdaptedVideoTrackSource,
   void OnCaptureResult(webrtc::DesktopCapturer::Result result,
                        std::unique_ptr<webrtc::DesktopFrame> frame) override;
 
+  // Returns an `I420Buffer` to convert the damaged regions of the next frame
+  // into.
+  //
+  // Reuses the `last_buffer_` in place if nobody but the `buffer_pool_`
+  // references it, or copies it into a pooled one otherwise, so the undamaged
+  // regions never need to be converted again.
+  rtc::scoped_refptr<webrtc::I420Buffer> AcquireBuffer(
+      const webrtc::DesktopSize& size,
+      bool full_refresh);
+
+  // Emits a `VideoFrame` with the provided `buffer` and remembers it as the
+  // `last_buffer_`.
+  void EmitFrame(rtc::scoped_refptr<webrtc::I420Buffer> buffer);
+
+  // Re-emits the `last_buffer_` if nothing has been emitted for too long, so
+  // the encoder always has a recent frame to produce a key frame from.
+  void RepeatLastFrame();
+
   // `VideoSinkInterface` implementation.
   void OnFrame(const webrtc::VideoFrame& frame) override;
 
@@ -86,8 +113,8 @@ class ScreenVideoCapturer : public rtc::AdaptedVideoTrackSource,
   // Max height of the captured `VideoFrame`.
   size_t max_height_;
 
-  // Target frame capturing interval.
-  int requested_frame_duration_;
+  // Scheduler pacing the frame captures.
+  CaptureScheduler scheduler_;
 
   // Width of the captured `DesktopFrame`.
   size_t capture_width_;
@@ -98,9 +125,18 @@ class ScreenVideoCapturer : public rtc::AdaptedVideoTrackSource,
   // Size of the previous captured `DesktopFrame`.
   webrtc::DesktopSize previous_frame_size_;
 
-  // Last captured `DesktopFrame`.
+  // Last captured `DesktopFrame` scaled to the output size.
   std::unique_ptr<webrtc::DesktopFrame> output_frame_;
 
+  // Pool of the `I420Buffer`s the captured frames are converted into.
+  I420BufferPool buffer_pool_;
+
+  // `I420Buffer` of the last emitted `VideoFrame`.
+  rtc::scoped_refptr<webrtc::I420Buffer> last_buffer_;
+
+  // Time of the last emitted `VideoFrame` in milliseconds.
+  int64_t last_frame_time_ms_ = 0;
+
   // `PlatformThread` performing the actual frames capturing.
   rtc::PlatformThread capture_thread_;
 
@@ -112,6 +148,10 @@ class ScreenVideoCapturer : public rtc::AdaptedVideoTrackSource,
 
   // Flag signaling the `capture_thread_` to stop.
   std::atomic<bool> quit_;
+
+  // Event waking up the `capture_thread_` waiting for the next capture, once
+  // it should stop.
+  rtc::Event stop_event_;
 };
 
 #endif // BRIDGE_SCREEN_VIDEO_CAPTURER_H_
@@ -11,6 +11,7 @@ using RTCStatsReport = rtc::scoped_refptr<const webrtc::RTCStatsReport>;
 using RTCStats = webrtc::RTCStats;
 
 struct RTCStatsWrap;
+struct RTCStatsColumns;
 struct RTCMediaSourceStatsWrap;
 struct RTCVideoSourceStatsWrap;
 struct RTCAudioSourceStatsWrap;
@@ -73,9 +74,25 @@ RTCAudioSourceStatsWrap cast_to_rtc_audio_source_stats(
 RTCVideoSourceStatsWrap cast_to_rtc_video_source_stats(
     std::unique_ptr<RTCMediaSourceStats> stats);
 
-// Returns collection of wrapped `RTCStats` of the provided `RTCStatsReport`.
-rust::Vec<RTCStatsWrap> rtc_stats_report_get_stats(
-    const RTCStatsReport& report);
+// Indicates whether the `RTCStatsType` of the provided `RTCStats` is in the
+// `type_mask`.
+bool stats_type_selected(const RTCStats& stats, uint32_t type_mask);
+
+// Returns collection of wrapped `RTCStats` of the provided `RTCStatsReport`,
+// having their `RTCStatsType` in the provided `type_mask`.
+rust::Vec<RTCStatsWrap> rtc_stats_report_get_stats(const RTCStatsReport& report,
+                                                   uint32_t type_mask);
+
+// Returns collection of wrapped `RTCStats` of the provided `RTCStatsReport`
+// with the provided `ids`, skipping the missing ones.
+rust::Vec<RTCStatsWrap> rtc_stats_report_get_stats_by_ids(
+    const RTCStatsReport& report,
+    rust::Slice<const rust::String> ids);
+
+// Returns `RTCStatsColumns` of the `RTCStats` of the provided `RTCStatsReport`,
+// having their `RTCStatsType` in the provided `type_mask`.
+RTCStatsColumns rtc_stats_report_get_columns(const RTCStatsReport& report,
+                                             uint32_t type_mask);
 
 }  // namespace bridge
 
@@ -0,0 +1,125 @@
+#ifndef BRIDGE_SYNTHETIC_AUDIO_SOURCE_H_
+#define BRIDGE_SYNTHETIC_AUDIO_SOURCE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "libwebrtc-sys/include/local_audio_source.h"
+
+namespace bridge {
+
+// Signal generated by a `SyntheticAudioSource`.
+enum class SyntheticSignal {
+  // Digital silence.
+  kSilence,
+
+  // Sine tone of the `SyntheticAudioOptions::frequencyHz`.
+  kSine,
+
+  // Linear sweep from `kSweepStartHz` to `kSweepEndHz`, repeated every
+  // `kSweepDurationMs`.
+  kSweep,
+
+  // White noise of a fixed seed, so it's repeatable between runs.
+  kNoise,
+
+  // Looped contents of the `SyntheticAudioOptions::wavPath` file.
+  kWavFile,
+};
+
+// Frequencies and duration of the `SyntheticSignal::kSweep`.
+const int kSweepStartHz = 100;
+const int kSweepEndHz = 8000;
+const int kSweepDurationMs = 5000;
+
+// Frequency of the marker tone, in Hz.
+const int kMarkerFrequencyHz = 2000;
+
+// Parameters of a `SyntheticAudioSource`.
+struct SyntheticAudioOptions {
+  // Generated signal.
+  SyntheticSignal signal = SyntheticSignal::kSilence;
+
+  // Frequency of the `SyntheticSignal::kSine`, in Hz.
+  int frequencyHz = 440;
+
+  // Path to the 16-bit PCM WAV file of the `SyntheticSignal::kWavFile`.
+  std::string wavPath;
+
+  // Interval between the markers in milliseconds, or `0` to not emit them.
+  //
+  // Rounded down to a multiple of 10 ms.
+  int markerIntervalMs = 0;
+};
+
+// `LocalAudioSource` producing a deterministic synthetic signal.
+//
+// Audio is produced in 10 ms blocks by a single timer thread shared by all the
+// `SyntheticAudioSource`s, paced by absolute deadlines. Generated signals are
+// 48 kHz mono at -12 dBFS, while WAV files are read into memory on creation
+// and played in their own format.
+//
+// Markers replace whole blocks with a full-scale `kMarkerFrequencyHz` tone,
+// starting from the very first block, so they're easily detected on the
+// receiving side by their energy. Each block carries its capture time as the
+// absolute capture timestamp, allowing to measure the mouth-to-ear latency.
+class SyntheticAudioSource : public LocalAudioSource {
+ public:
+  // Creates a new `SyntheticAudioSource` and starts producing its audio.
+  //
+  // Returns `nullptr` if the WAV file can't be opened or isn't supported.
+  static rtc::scoped_refptr<SyntheticAudioSource> Create(
+      SyntheticAudioOptions options);
+
+  // Produces the next 10 ms block captured at the provided monotonic time.
+  //
+  // Must only be called by the timer thread.
+  void ProduceBlock(int64_t capture_time_ms);
+
+ protected:
+  SyntheticAudioSource(SyntheticAudioOptions options,
+                       int sample_rate,
+                       size_t channels,
+                       std::vector<int16_t> wav_samples);
+  ~SyntheticAudioSource() override;
+
+ private:
+  // Writes the next samples of the generated signal into the `_block`.
+  void generateSignal();
+
+  // Copies the next samples of the looped WAV file into the `_block`.
+  void readWav();
+
+  // Overwrites the `_block` with the marker tone.
+  void drawMarker();
+
+  // Parameters of this source.
+  const SyntheticAudioOptions _options;
+
+  // Interleaved samples of the looped WAV file, if any.
+  std::vector<int16_t> _wavSamples;
+
+  // Position of the next sample to copy from the `_wavSamples`.
+  size_t _wavPosition = 0;
+
+  // Format of the produced audio.
+  int _sampleRate;
+  size_t _channels;
+
+  // Interleaved samples of the current block.
+  std::vector<int16_t> _block;
+
+  // Number of the produced blocks.
+  uint64_t _blockNumber = 0;
+
+  // Phase of the generated tone, in radians.
+  double _phase = 0;
+
+  // State of the noise generator.
+  uint64_t _noiseState;
+};
+
+}  // namespace bridge
+
+#endif  // BRIDGE_SYNTHETIC_AUDIO_SOURCE_H_
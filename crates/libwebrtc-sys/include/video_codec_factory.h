@@ -0,0 +1,101 @@
+#ifndef BRIDGE_VIDEO_CODEC_FACTORY_H_
+#define BRIDGE_VIDEO_CODEC_FACTORY_H_
+
+#include <memory>
+#include <vector>
+
+#include "api/video/video_codec_type.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_decoder_factory.h"
+#include "api/video_codecs/video_encoder_factory.h"
+
+// Settings of a single enabled codec of a `VideoCodecPreferences`.
+struct VideoCodecPreference {
+  // Type of the configured codec.
+  webrtc::VideoCodecType type;
+
+  // Complexity of the encoders of this codec.
+  //
+  // `kComplexityNormal` leaves the default complexity of the encoder.
+  webrtc::VideoCodecComplexity complexity =
+      webrtc::VideoCodecComplexity::kComplexityNormal;
+};
+
+// Video codecs of a `PeerConnectionFactoryInterface`.
+struct VideoCodecPreferences {
+  // Enabled codecs, the most preferred first.
+  //
+  // Codecs not listed here are neither encoded nor decoded.
+  std::vector<VideoCodecPreference> codecs;
+
+  // Indicator whether VP9 spatial scalability modes are supported.
+  bool vp9_svc = true;
+};
+
+// `VideoEncoderFactory` enabling and ordering the codecs of the wrapped one
+// according to the provided `VideoCodecPreferences`.
+//
+// Since the media engine lists the codecs in the order of the supported
+// formats, this order becomes the default codec preferences of every
+// transceiver.
+class PreferredVideoEncoderFactory : public webrtc::VideoEncoderFactory {
+ public:
+  PreferredVideoEncoderFactory(
+      std::unique_ptr<webrtc::VideoEncoderFactory> factory,
+      VideoCodecPreferences preferences);
+
+  // Returns the supported formats of the enabled codecs in their preference
+  // order.
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+
+  // Reports the disabled codecs as unsupported.
+  CodecSupport QueryCodecSupport(
+      const webrtc::SdpVideoFormat& format,
+      absl::optional<std::string> scalability_mode) const override;
+
+  // Creates a new encoder of the provided `format`, applying its configured
+  // complexity, or returns `nullptr` if its codec is disabled.
+  std::unique_ptr<webrtc::VideoEncoder> CreateVideoEncoder(
+      const webrtc::SdpVideoFormat& format) override;
+
+  // Returns the `EncoderSelectorInterface` of the wrapped factory.
+  std::unique_ptr<EncoderSelectorInterface> GetEncoderSelector() const override;
+
+ private:
+  // Wrapped `VideoEncoderFactory`.
+  std::unique_ptr<webrtc::VideoEncoderFactory> factory_;
+
+  // Enabled codecs and their settings.
+  const VideoCodecPreferences preferences_;
+};
+
+// `VideoDecoderFactory` enabling and ordering the codecs of the wrapped one
+// according to the provided `VideoCodecPreferences`.
+class PreferredVideoDecoderFactory : public webrtc::VideoDecoderFactory {
+ public:
+  PreferredVideoDecoderFactory(
+      std::unique_ptr<webrtc::VideoDecoderFactory> factory,
+      VideoCodecPreferences preferences);
+
+  // Returns the supported formats of the enabled codecs in their preference
+  // order.
+  std::vector<webrtc::SdpVideoFormat> GetSupportedFormats() const override;
+
+  // Reports the disabled codecs as unsupported.
+  CodecSupport QueryCodecSupport(const webrtc::SdpVideoFormat& format,
+                                 bool reference_scaling) const override;
+
+  // Creates a new decoder of the provided `format`, or returns `nullptr` if
+  // its codec is disabled.
+  std::unique_ptr<webrtc::VideoDecoder> CreateVideoDecoder(
+      const webrtc::SdpVideoFormat& format) override;
+
+ private:
+  // Wrapped `VideoDecoderFactory`.
+  std::unique_ptr<webrtc::VideoDecoderFactory> factory_;
+
+  // Enabled codecs.
+  const VideoCodecPreferences preferences_;
+};
+
+#endif  // BRIDGE_VIDEO_CODEC_FACTORY_H_
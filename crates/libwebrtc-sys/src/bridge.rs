@@ -5,10 +5,10 @@ use cxx::{CxxString, CxxVector, UniquePtr};
 use derive_more::{Deref, DerefMut};
 
 use crate::{
-    AddIceCandidateCallback, CreateSdpCallback, IceCandidateInterface,
-    OnFrameCallback, PeerConnectionEventsHandler, RTCStatsCollectorCallback,
-    RtpReceiverInterface, RtpTransceiverInterface, SetDescriptionCallback,
-    TrackEventCallback,
+    AddIceCandidateCallback, AudioDeviceModuleCallback, CreateSdpCallback,
+    IceCandidateInterface, OnFrameCallback, PeerConnectionEventsHandler,
+    RTCStatsCollectorCallback, RtpReceiverInterface, RtpTransceiverInterface,
+    SetDescriptionCallback, TrackEventCallback,
 };
 
 /// [`CreateSdpCallback`] transferable to the C++ side.
@@ -26,6 +26,9 @@ type DynPeerConnectionEventsHandler = Box<dyn PeerConnectionEventsHandler>;
 /// [`AddIceCandidateCallback`] transferable to the C++ side.
 type DynAddIceCandidateCallback = Box<dyn AddIceCandidateCallback>;
 
+/// [`AudioDeviceModuleCallback`] transferable to the C++ side.
+type DynAudioDeviceModuleCallback = Box<dyn AudioDeviceModuleCallback>;
+
 /// [`RTCStatsCollectorCallback`] transferable to the C++ side.
 type DynRTCStatsCollectorCallback = Box<dyn RTCStatsCollectorCallback>;
 
@@ -143,6 +146,216 @@ pub(crate) mod webrtc {
         second: String,
     }
 
+    /// Constraints on [`VideoFrame`]s a [`VideoSinkInterface`] wants to
+    /// receive, propagated to the video source.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    pub struct VideoSinkWants {
+        /// Maximum number of pixels per [`VideoFrame`].
+        pub max_pixel_count: i32,
+
+        /// Maximum framerate of [`VideoFrame`]s.
+        pub max_framerate_fps: i32,
+
+        /// Number both dimensions of [`VideoFrame`]s should be divisible by.
+        pub resolution_alignment: i32,
+    }
+
+    /// Counters of the `I420Buffer` pools recycling frame buffers of the
+    /// screen capturers and fake video sources.
+    #[derive(Clone, Copy, Debug, Default, Eq, PartialEq)]
+    pub struct I420BufferPoolStats {
+        /// Total number of buffers reused from the pools.
+        pub hits: u64,
+
+        /// Total number of buffers allocated because no pooled ones were
+        /// available.
+        pub misses: u64,
+
+        /// Maximum number of buffers kept by every pool.
+        pub depth: usize,
+    }
+
+    /// Content of the frames produced by a fake video source.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    #[repr(u8)]
+    pub enum FakeVideoContent {
+        /// Black frames.
+        Black,
+
+        /// Diagonal color gradient moving with every frame.
+        Gradient,
+
+        /// Pseudo-random noise, repeatable between runs.
+        Noise,
+    }
+
+    /// Signal produced by a fake audio source.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    #[repr(u8)]
+    pub enum FakeAudioSignal {
+        /// Digital silence.
+        Silence,
+
+        /// Sine tone of the [`FakeAudioOptions::frequency_hz`].
+        Sine,
+
+        /// Linear sweep from 100 Hz to 8 kHz, repeated every 5 seconds.
+        Sweep,
+
+        /// White noise, repeatable between runs.
+        Noise,
+
+        /// Looped contents of the [`FakeAudioOptions::wav_path`] file.
+        WavFile,
+    }
+
+    /// Parameters of a fake audio source.
+    ///
+    /// Audio is produced in 10 ms blocks, carrying their capture time as the
+    /// absolute capture timestamp. Generated signals are 48 kHz mono at
+    /// -12 dBFS, while WAV files are played in their own format.
+    #[derive(Clone, Debug, Eq, PartialEq)]
+    pub struct FakeAudioOptions {
+        /// Produced signal.
+        pub signal: FakeAudioSignal,
+
+        /// Frequency of the [`FakeAudioSignal::Sine`], in Hz.
+        pub frequency_hz: u32,
+
+        /// Path to the 16-bit PCM WAV file of the
+        /// [`FakeAudioSignal::WavFile`].
+        pub wav_path: String,
+
+        /// Interval between the markers, in milliseconds, or `0` to not emit
+        /// them.
+        ///
+        /// A marker replaces a whole 10 ms block with a full-scale 2 kHz
+        /// tone, so it's easily detected on the receiving side.
+        pub marker_interval_ms: u32,
+    }
+
+    /// Software video codec of a [`PeerConnectionFactoryInterface`].
+    #[derive(Clone, Copy, Debug, Eq, Hash, PartialEq)]
+    #[repr(u8)]
+    pub enum VideoCodecKind {
+        /// VP8 codec of `libvpx`.
+        VP8,
+
+        /// VP9 codec of `libvpx`.
+        VP9,
+
+        /// H.264 codec of `OpenH264`.
+        H264,
+
+        /// AV1 codec, encoded by `libaom` and decoded by `dav1d`.
+        AV1,
+    }
+
+    /// Complexity of a video encoder, trading its CPU usage for the quality.
+    ///
+    /// For AV1 it selects the speed preset of `libaom`.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    #[repr(u8)]
+    pub enum VideoEncoderComplexity {
+        /// Lowest CPU usage.
+        Low,
+
+        /// Default complexity of the encoder.
+        Normal,
+
+        /// Higher quality at the cost of more CPU usage.
+        High,
+
+        /// Even higher quality at the cost of even more CPU usage.
+        Higher,
+
+        /// Highest quality regardless of the CPU usage.
+        Max,
+    }
+
+    /// Settings of a single enabled [`VideoCodecKind`].
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    pub struct VideoCodecSettings {
+        /// Configured [`VideoCodecKind`].
+        pub kind: VideoCodecKind,
+
+        /// [`VideoEncoderComplexity`] of the encoders of this codec.
+        pub complexity: VideoEncoderComplexity,
+    }
+
+    /// Configuration of the video codecs of a
+    /// [`PeerConnectionFactoryInterface`].
+    #[derive(Clone, Debug, Eq, PartialEq)]
+    pub struct VideoCodecConfig {
+        /// Enabled codecs in their preference order, the most preferred first.
+        ///
+        /// This order is used for the codecs of every transceiver, unless it
+        /// sets its own preferences. Codecs not listed here are neither
+        /// encoded nor decoded, so they're never negotiated.
+        pub codecs: Vec<VideoCodecSettings>,
+
+        /// Indicator whether VP9 spatial scalability (SVC) modes are
+        /// supported.
+        ///
+        /// If `false`, only the temporal scalability modes are offered for
+        /// VP9.
+        pub vp9_svc: bool,
+    }
+
+    /// Format of the audio samples recorded from an audio device.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    #[repr(u8)]
+    pub enum AudioSampleFormat {
+        /// Signed 16-bit integer samples.
+        Int16,
+
+        /// 32-bit floating point samples.
+        Float32,
+    }
+
+    /// Parameters of the audio recording from an audio device.
+    ///
+    /// Recorded audio is propagated in 10 ms frames of 16-bit samples,
+    /// resampled to 48 kHz if the [`AudioCaptureFormat::sample_rate`] isn't
+    /// natively supported by the audio processing (8, 16, 32 or 48 kHz).
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    pub struct AudioCaptureFormat {
+        /// Sample rate the device is recorded with, in Hz.
+        ///
+        /// Must be a multiple of `100` within `8000..=48000`.
+        pub sample_rate: u32,
+
+        /// Number of the recorded channels, either `1` or `2`.
+        pub channels: u8,
+
+        /// Format of the samples the device is recorded with.
+        ///
+        /// Falls back to [`AudioSampleFormat::Int16`] if
+        /// [`AudioSampleFormat::Float32`] is not supported by OpenAL.
+        pub sample_format: AudioSampleFormat,
+
+        /// Size of the OpenAL capture ring, in milliseconds.
+        ///
+        /// Must be within `20..=10000`.
+        pub ring_size_ms: u32,
+    }
+
+    /// Processing of the audio recorded from an audio device.
+    #[derive(Clone, Copy, Debug, Eq, PartialEq)]
+    pub struct AudioProcessingOptions {
+        /// Indicator whether the echo cancellation is enabled.
+        pub echo_cancellation: bool,
+
+        /// Indicator whether the noise suppression is enabled.
+        pub noise_suppression: bool,
+
+        /// Indicator whether the automatic gain control is enabled.
+        pub auto_gain_control: bool,
+
+        /// Indicator whether the high-pass filter is enabled.
+        pub high_pass_filter: bool,
+    }
+
     // TODO: Remove once `cxx` crate allows using pointers to opaque types in
     //       vectors: https://github.com/dtolnay/cxx/issues/741
     /// Wrapper for an [`RtpEncodingParameters`] usable in Rust/C++ vectors.
@@ -951,6 +1164,266 @@ pub(crate) mod webrtc {
         Unimplemented,
     }
 
+    /// Column of an [`RTCStatsColumns`] buffer, named after the
+    /// [RTCStats] member it holds.
+    ///
+    /// Columns starting from the [`RTCStatsColumn::Kind`] hold strings, and
+    /// all the others hold numbers.
+    ///
+    /// [RTCStats]: https://w3.org/TR/webrtc-stats
+    #[derive(Clone, Copy, Debug, Eq, Hash, PartialEq)]
+    #[repr(u8)]
+    pub enum RTCStatsColumn {
+        /// `bytesSent`.
+        BytesSent = 0,
+
+        /// `bytesReceived`.
+        BytesReceived,
+
+        /// `headerBytesSent`.
+        HeaderBytesSent,
+
+        /// `headerBytesReceived`.
+        HeaderBytesReceived,
+
+        /// `packetsSent`.
+        PacketsSent,
+
+        /// `packetsReceived`.
+        PacketsReceived,
+
+        /// `packetsLost`.
+        PacketsLost,
+
+        /// `retransmittedPacketsSent`.
+        RetransmittedPacketsSent,
+
+        /// `retransmittedBytesSent`.
+        RetransmittedBytesSent,
+
+        /// `nackCount`.
+        NackCount,
+
+        /// `firCount`.
+        FirCount,
+
+        /// `pliCount`.
+        PliCount,
+
+        /// `jitter`.
+        Jitter,
+
+        /// `jitterBufferDelay`.
+        JitterBufferDelay,
+
+        /// `jitterBufferEmittedCount`.
+        JitterBufferEmittedCount,
+
+        /// `frameWidth`.
+        FrameWidth,
+
+        /// `frameHeight`.
+        FrameHeight,
+
+        /// `framesPerSecond`.
+        FramesPerSecond,
+
+        /// `framesSent`.
+        FramesSent,
+
+        /// `framesEncoded`.
+        FramesEncoded,
+
+        /// `framesReceived`.
+        FramesReceived,
+
+        /// `framesDecoded`.
+        FramesDecoded,
+
+        /// `keyFramesDecoded`.
+        KeyFramesDecoded,
+
+        /// `framesDropped`.
+        FramesDropped,
+
+        /// `qpSum`.
+        QpSum,
+
+        /// `totalEncodeTime`.
+        TotalEncodeTime,
+
+        /// `totalDecodeTime`.
+        TotalDecodeTime,
+
+        /// `totalInterFrameDelay`.
+        TotalInterFrameDelay,
+
+        /// `freezeCount`.
+        FreezeCount,
+
+        /// `totalFreezesDuration`.
+        TotalFreezesDuration,
+
+        /// `targetBitrate`.
+        TargetBitrate,
+
+        /// `totalSamplesReceived`.
+        TotalSamplesReceived,
+
+        /// `concealedSamples`.
+        ConcealedSamples,
+
+        /// `silentConcealedSamples`.
+        SilentConcealedSamples,
+
+        /// `concealmentEvents`.
+        ConcealmentEvents,
+
+        /// `audioLevel`.
+        AudioLevel,
+
+        /// `totalAudioEnergy`.
+        TotalAudioEnergy,
+
+        /// `totalSamplesDuration`.
+        TotalSamplesDuration,
+
+        /// `echoReturnLoss`.
+        EchoReturnLoss,
+
+        /// `echoReturnLossEnhancement`.
+        EchoReturnLossEnhancement,
+
+        /// `width`.
+        Width,
+
+        /// `height`.
+        Height,
+
+        /// `frames`.
+        Frames,
+
+        /// `roundTripTime`.
+        RoundTripTime,
+
+        /// `totalRoundTripTime`.
+        TotalRoundTripTime,
+
+        /// `currentRoundTripTime`.
+        CurrentRoundTripTime,
+
+        /// `roundTripTimeMeasurements`.
+        RoundTripTimeMeasurements,
+
+        /// `fractionLost`.
+        FractionLost,
+
+        /// `availableOutgoingBitrate`.
+        AvailableOutgoingBitrate,
+
+        /// `availableIncomingBitrate`.
+        AvailableIncomingBitrate,
+
+        /// `nominated`.
+        Nominated,
+
+        /// `reportsSent`.
+        ReportsSent,
+
+        /// `remoteTimestamp`.
+        RemoteTimestamp,
+
+        /// `ssrc`.
+        Ssrc,
+
+        /// `port`.
+        Port,
+
+        /// `priority`.
+        Priority,
+
+        /// `kind`.
+        ///
+        /// The first of the string columns.
+        Kind,
+
+        /// `mid`.
+        Mid,
+
+        /// `rid`.
+        Rid,
+
+        /// `trackIdentifier`.
+        TrackIdentifier,
+
+        /// `mediaSourceId`.
+        MediaSourceId,
+
+        /// `transportId`.
+        TransportId,
+
+        /// `codecId`.
+        CodecId,
+
+        /// `remoteId`.
+        RemoteId,
+
+        /// `localId`.
+        LocalId,
+
+        /// `state`.
+        State,
+
+        /// `address`.
+        Address,
+
+        /// `protocol`.
+        Protocol,
+
+        /// `candidateType`.
+        CandidateType,
+
+        /// `url`.
+        Url,
+
+        /// `qualityLimitationReason`.
+        QualityLimitationReason,
+    }
+
+    /// Stats of an [`RTCStatsReport`] laid out as a fixed-schema
+    /// struct-of-arrays.
+    ///
+    /// Every [`RTCStatsColumn`] of every row is stored at the
+    /// `column * rows + row` index of the `values`, and is present if the bit
+    /// with the same index is set in the `presence` bitmap. String values are
+    /// interned, so the `values` of the string columns are indices of the
+    /// `strings`.
+    pub struct RTCStatsColumns {
+        /// Number of rows, one per [`RTCStats`].
+        pub rows: usize,
+
+        /// Number of columns, one per [`RTCStatsColumn`].
+        pub columns: usize,
+
+        /// [`RTCStatsType`] discriminant of every row.
+        pub kinds: Vec<i32>,
+
+        /// Index of the ID of every row in the `strings`.
+        pub ids: Vec<u32>,
+
+        /// Timestamp of every row, in microseconds.
+        pub timestamps_us: Vec<i64>,
+
+        /// Values of all the columns, column by column.
+        pub values: Vec<f64>,
+
+        /// Bitmap of the present `values`.
+        pub presence: Vec<u64>,
+
+        /// Interned strings of this report.
+        pub strings: Vec<String>,
+    }
+
     /// Possible kinds of a media.
     #[derive(Debug, Eq, Hash, PartialEq)]
     #[repr(i32)]
@@ -1205,13 +1678,15 @@ pub(crate) mod webrtc {
         #[cxx_name = "Start"]
         pub fn start_thread(self: Pin<&mut Thread>) -> bool;
 
-        /// Creates a new [`PeerConnectionFactoryInterface`].
+        /// Creates a new [`PeerConnectionFactoryInterface`] with the provided
+        /// [`VideoCodecConfig`].
         pub fn create_peer_connection_factory(
             network_thread: &UniquePtr<Thread>,
             worker_thread: &UniquePtr<Thread>,
             signaling_thread: &UniquePtr<Thread>,
             default_adm: &UniquePtr<AudioDeviceModule>,
             ap: &UniquePtr<AudioProcessing>,
+            video_codecs: &VideoCodecConfig,
         ) -> UniquePtr<PeerConnectionFactoryInterface>;
     }
 
@@ -1318,6 +1793,41 @@ pub(crate) mod webrtc {
             audio_device_module: &AudioDeviceModule,
             index: u16,
         ) -> i32;
+
+        /// Sets the number of 10 ms buffers kept queued for playout by the
+        /// given [`AudioDeviceModule`].
+        pub fn set_playout_buffer_depth(
+            audio_device_module: &AudioDeviceModule,
+            buffers: u16,
+        ) -> i32;
+
+        /// Asynchronously specifies which speaker to use for playing out
+        /// audio, passing the result to the provided
+        /// [`DynAudioDeviceModuleCallback`].
+        pub fn set_audio_playout_device_async(
+            audio_device_module: &AudioDeviceModule,
+            index: u16,
+            cb: Box<DynAudioDeviceModuleCallback>,
+        );
+
+        /// Asynchronously sets the microphone volume level, passing the result
+        /// to the provided [`DynAudioDeviceModuleCallback`].
+        pub fn set_microphone_volume_async(
+            audio_device_module: &AudioDeviceModule,
+            volume: u32,
+            cb: Box<DynAudioDeviceModuleCallback>,
+        );
+    }
+
+    extern "Rust" {
+        pub type DynAudioDeviceModuleCallback;
+
+        /// Calls the [`DynAudioDeviceModuleCallback`] with the `result` of an
+        /// asynchronous [`AudioDeviceModule`] call.
+        pub fn on_audio_device_module_call_done(
+            mut cb: Box<DynAudioDeviceModuleCallback>,
+            result: i32,
+        );
     }
 
     unsafe extern "C++" {
@@ -1887,6 +2397,20 @@ pub(crate) mod webrtc {
             peer: &PeerConnectionInterface,
             cb: Box<DynRTCStatsCollectorCallback>,
         );
+
+        /// Calls the selector-based [RTCPeerConnection.getStats()][1] for the
+        /// senders and receivers of the tracks and transceivers (by their
+        /// `mid`s) with the provided `ids`, merging the stats of the
+        /// [`RTCStatsType`]s in the provided `type_mask` of their reports into
+        /// a single one.
+        ///
+        /// [1]: https://tinyurl.com/2p84b6r4
+        pub fn peer_connection_get_selected_stats(
+            peer: &PeerConnectionInterface,
+            ids: &Vec<String>,
+            type_mask: u32,
+            cb: Box<DynRTCStatsCollectorCallback>,
+        );
     }
 
     extern "Rust" {
@@ -1951,11 +2475,30 @@ pub(crate) mod webrtc {
         pub type RTCStatsReport;
         pub type RTCStats;
 
-        /// Returns collection of wrapped [`RTCStats`].
+        /// Returns collection of wrapped [`RTCStats`] of the [`RTCStatsType`]s
+        /// in the provided `type_mask`.
+        ///
+        /// [`RTCStatsType`] is included if the bit of its discriminant is set.
         pub fn rtc_stats_report_get_stats(
             report: &RTCStatsReport,
+            type_mask: u32,
         ) -> Vec<RTCStatsWrap>;
 
+        /// Returns collection of wrapped [`RTCStats`] with the provided `ids`.
+        ///
+        /// IDs missing in the report are skipped.
+        pub fn rtc_stats_report_get_stats_by_ids(
+            report: &RTCStatsReport,
+            ids: &[String],
+        ) -> Vec<RTCStatsWrap>;
+
+        /// Returns [`RTCStatsColumns`] of the [`RTCStats`] of the
+        /// [`RTCStatsType`]s in the provided `type_mask`.
+        pub fn rtc_stats_report_get_columns(
+            report: &RTCStatsReport,
+            type_mask: u32,
+        ) -> RTCStatsColumns;
+
         /// Tries to cast [`RTCStats`] into [`RTCMediaSourceStatsWrap`].
         ///
         /// # Errors
@@ -2190,17 +2733,25 @@ pub(crate) mod webrtc {
             device_index: u32,
         ) -> UniquePtr<VideoTrackSourceInterface>;
 
-        /// Creates a new fake [`VideoTrackSourceInterface`].
+        /// Creates a new fake [`VideoTrackSourceInterface`] producing frames
+        /// of the provided [`FakeVideoContent`].
+        ///
+        /// If `counter_overlay` is `true`, then the frame number and its
+        /// capture time are encoded in the top-left corner of every frame as
+        /// two rows of 64 black (`0`) and white (`1`) cells.
         pub fn create_fake_device_video_source(
             worker_thread: Pin<&mut Thread>,
             signaling_thread: Pin<&mut Thread>,
             width: usize,
             height: usize,
             fps: usize,
+            content: FakeVideoContent,
+            counter_overlay: bool,
         ) -> UniquePtr<VideoTrackSourceInterface>;
 
         /// Creates a new [`VideoTrackSourceInterface`] sourced by a screen
-        /// capturing.
+        /// capturing, spending at most `cpu_budget_percentage` of a CPU core
+        /// on it.
         pub fn create_display_video_source(
             worker_thread: Pin<&mut Thread>,
             signaling_thread: Pin<&mut Thread>,
@@ -2208,12 +2759,44 @@ pub(crate) mod webrtc {
             width: usize,
             height: usize,
             fps: usize,
+            cpu_budget_percentage: u8,
         ) -> UniquePtr<VideoTrackSourceInterface>;
 
-        /// Creates a new [`AudioSourceInterface`].
+        /// Returns the [`I420BufferPoolStats`] of all the screen capturers and
+        /// fake video sources.
+        pub fn i420_buffer_pool_stats() -> I420BufferPoolStats;
+
+        /// Sets the maximum number of `I420Buffer`s kept by the pool of every
+        /// screen capturer and fake video source.
+        pub fn set_i420_buffer_pool_depth(depth: usize);
+
+        /// Enables caching of the enumerated audio devices, so they're
+        /// enumerated only once until [`invalidate_audio_device_cache()`] is
+        /// called.
+        ///
+        /// Must only be enabled once the audio devices changes are tracked.
+        pub fn enable_audio_device_cache();
+
+        /// Disables caching of the enumerated audio devices, so they're
+        /// re-enumerated on every query.
+        ///
+        /// Must be called once the audio devices changes aren't tracked
+        /// anymore.
+        pub fn disable_audio_device_cache();
+
+        /// Drops the cached audio devices, so they're re-enumerated on the
+        /// next query.
+        pub fn invalidate_audio_device_cache();
+
+        /// Creates a new [`AudioSourceInterface`] recording the device with
+        /// the provided `device_index` in the provided [`AudioCaptureFormat`],
+        /// and processing the recorded audio according to the provided
+        /// [`AudioProcessingOptions`].
         pub fn create_audio_source(
             audio_device_module: &AudioDeviceModule,
             device_index: u16,
+            format: AudioCaptureFormat,
+            processing: AudioProcessingOptions,
         ) -> UniquePtr<AudioSourceInterface>;
 
         /// Disposes the [`AudioSourceInterface`] with the provided `device_id`.
@@ -2222,8 +2805,11 @@ pub(crate) mod webrtc {
             device_id: String,
         );
 
-        /// Creates a new fake [`AudioSourceInterface`].
-        pub fn create_fake_audio_source() -> UniquePtr<AudioSourceInterface>;
+        /// Creates a new fake [`AudioSourceInterface`] producing the signal
+        /// of the provided [`FakeAudioOptions`].
+        pub fn create_fake_audio_source(
+            options: &FakeAudioOptions,
+        ) -> UniquePtr<AudioSourceInterface>;
 
         /// Creates a new [`VideoTrackInterface`].
         pub fn create_video_track(
@@ -2316,6 +2902,7 @@ pub(crate) mod webrtc {
         pub fn add_or_update_video_sink(
             track: &VideoTrackInterface,
             sink: Pin<&mut VideoSinkInterface>,
+            wants: &VideoSinkWants,
         );
 
         /// Detaches the provided [`VideoSinkInterface`] from the given
@@ -2363,6 +2950,36 @@ pub(crate) mod webrtc {
             buffer: *mut u8,
         );
 
+        /// Converts the provided [`webrtc::VideoFrame`] pixels to the `ABGR`
+        /// scheme, scaled to `dst_width`x`dst_height` and rotated if
+        /// `apply_rotation` is set, and writes the result to the provided
+        /// `buffer` with the `dst_stride`.
+        ///
+        /// # Safety
+        ///
+        /// Caller must ensure that the provided `buffer` is large enough.
+        pub unsafe fn video_frame_to_abgr_scaled(
+            frame: &VideoFrame,
+            dst_width: i32,
+            dst_height: i32,
+            dst_stride: i32,
+            apply_rotation: bool,
+            buffer: *mut u8,
+        );
+
+        /// Creates a new [`VideoFrame`] sharing the pixel buffer of the
+        /// provided one.
+        #[must_use]
+        pub fn clone_video_frame(frame: &VideoFrame) -> UniquePtr<VideoFrame>;
+
+        /// Makes the provided `dst` [`VideoFrame`] share the pixel buffer and
+        /// metadata of the provided `src` one, reusing the `dst` allocation.
+        pub fn assign_video_frame(dst: Pin<&mut VideoFrame>, src: &VideoFrame);
+
+        /// Releases the pixel buffer referenced by the provided
+        /// [`VideoFrame`], keeping the [`VideoFrame`] allocation itself.
+        pub fn release_video_frame_buffer(frame: Pin<&mut VideoFrame>);
+
         /// Returns the timestamp of when the last data was received from the
         /// provided [`CandidatePairChangeEvent`].
         #[must_use]
@@ -2489,10 +3106,7 @@ pub(crate) mod webrtc {
 
         /// Forwards the given [`webrtc::VideoFrame`] the the provided
         /// [`DynOnFrameCallback`].
-        pub fn on_frame(
-            cb: &mut DynOnFrameCallback,
-            frame: UniquePtr<VideoFrame>,
-        );
+        pub fn on_frame(cb: &mut DynOnFrameCallback, frame: &VideoFrame);
     }
 
     extern "Rust" {
@@ -2705,7 +3319,7 @@ pub fn set_description_fail(
 
 /// Forwards the given [`webrtc::VideoFrame`] the the provided
 /// [`DynOnFrameCallback`].
-fn on_frame(cb: &mut DynOnFrameCallback, frame: UniquePtr<webrtc::VideoFrame>) {
+fn on_frame(cb: &mut DynOnFrameCallback, frame: &webrtc::VideoFrame) {
     cb.on_frame(frame);
 }
 
@@ -2893,6 +3507,16 @@ fn new_string_pair(f: &CxxString, s: &CxxString) -> webrtc::StringPair {
     }
 }
 
+/// Calls the [`DynAudioDeviceModuleCallback`] with the `result` of an
+/// asynchronous [`webrtc::AudioDeviceModule`] call.
+#[allow(clippy::boxed_local)]
+pub fn on_audio_device_module_call_done(
+    mut cb: Box<DynAudioDeviceModuleCallback>,
+    result: i32,
+) {
+    cb.on_done(result);
+}
+
 /// Calls the success [`DynAddIceCandidateCallback`].
 #[allow(clippy::boxed_local)]
 pub fn add_ice_candidate_success(mut cb: Box<DynAddIceCandidateCallback>) {
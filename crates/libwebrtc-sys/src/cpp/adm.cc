@@ -24,12 +24,14 @@
 #include <iostream>
 
 #include <algorithm>
+#include <atomic>
 #include <cfenv>
 #include <chrono>
 #include <cmath>
 #include <thread>
 #include <vector>
 #include "adm.h"
+#include "audio_device_registry.h"
 #include "api/make_ref_counted.h"
 #include "common_audio/wav_file.h"
 #include "modules/audio_device/include/test_audio_device.h"
@@ -56,6 +58,9 @@ using ALEVENTPROCSOFT = void (*)(ALenum eventType,
                                  const ALchar* message,
                                  void* userParam);
 using ALEVENTCALLBACKSOFT = void (*)(ALEVENTPROCSOFT callback, void* userParam);
+using ALEVENTCONTROLSOFT = void (*)(ALsizei count,
+                                    const ALenum* types,
+                                    ALboolean enable);
 using ALCSETTHREADCONTEXT = ALCboolean (*)(ALCcontext* context);
 using ALGETSOURCEI64VSOFT = void (*)(ALuint source,
                                      ALenum param,
@@ -66,6 +71,7 @@ using ALCGETINTEGER64VSOFT = void (*)(ALCdevice* device,
                                       AL_INT64_TYPE* values);
 
 ALEVENTCALLBACKSOFT alEventCallbackSOFT /* = nullptr*/;
+ALEVENTCONTROLSOFT alEventControlSOFT /* = nullptr*/;
 ALCSETTHREADCONTEXT alcSetThreadContext /* = nullptr*/;
 ALGETSOURCEI64VSOFT alGetSourcei64vSOFT /* = nullptr*/;
 ALCGETINTEGER64VSOFT alcGetInteger64vSOFT /* = nullptr*/;
@@ -82,8 +88,17 @@ struct OpenALAudioDeviceModule::Data {
   std::unique_ptr<rtc::Thread> _recordingThread;
   ALuint source = 0;
   int queuedBuffersCount = 0;
-  std::array<ALuint, kBuffersFullCount> buffers = {{0}};
-  std::array<bool, kBuffersFullCount> queuedBuffers = {{false}};
+  std::vector<ALuint> buffers;
+  std::vector<bool> queuedBuffers;
+  // Buffers queued by the current refill, preallocated along with `buffers`.
+  std::vector<bool> refilledBuffers;
+  int buffersKeepReady = kBuffersKeepReadyCount;
+  // Indicator whether the playout is driven by `AL_SOFT_events`.
+  std::atomic<bool> eventsEnabled = false;
+  // Number of buffers completed by OpenAL since the last refill.
+  std::atomic<int> completedBuffers = 0;
+  // Indicator whether a refill is posted to the `_playoutThread` already.
+  std::atomic<bool> refillPending = false;
   int playBufferSize = kPlayoutPart * sizeof(int16_t) * 2;
   std::vector<char>* playoutSamples = new std::vector<char>(playBufferSize, 0);
   int64_t exactDeviceTimeCounter = 0;
@@ -94,7 +109,19 @@ struct OpenALAudioDeviceModule::Data {
 };
 
 bool OpenALAudioDeviceModule::Initialized() const {
-  return _initialized;
+  return hasState(kInitialized);
+}
+
+void OpenALAudioDeviceModule::setState(uint32_t flags, bool enabled) {
+  if (enabled) {
+    _state.fetch_or(flags);
+  } else {
+    _state.fetch_and(~flags);
+  }
+}
+
+bool OpenALAudioDeviceModule::hasState(StateFlag flag) const {
+  return (_state.load() & flag) != 0;
 }
 
 // Main initialization and termination.
@@ -111,6 +138,9 @@ int32_t OpenALAudioDeviceModule::Init() {
   alEventCallbackSOFT =
       (ALEVENTCALLBACKSOFT)alcGetProcAddress(nullptr, "alEventCallbackSOFT");
 
+  alEventControlSOFT =
+      (ALEVENTCONTROLSOFT)alcGetProcAddress(nullptr, "alEventControlSOFT");
+
   alGetSourcei64vSOFT =
       (ALGETSOURCEI64VSOFT)alcGetProcAddress(nullptr, "alGetSourcei64vSOFT");
 
@@ -130,6 +160,7 @@ int32_t OpenALAudioDeviceModule::Init() {
 #undef RESOLVE_ENUM
 
   _initialized = true;
+  setState(kInitialized, true);
 
   return 0;
 };
@@ -138,6 +169,7 @@ int32_t OpenALAudioDeviceModule::Terminate() {
   StopRecording();
   StopPlayout();
   _initialized = false;
+  setState(kInitialized, false);
 
   return 0;
 }
@@ -163,23 +195,8 @@ rtc::scoped_refptr<OpenALAudioDeviceModule> OpenALAudioDeviceModule::Create(
   return adm;
 }
 
-template <typename Callback>
-void EnumerateDevices(ALCenum specifier, Callback&& callback) {
-  auto devices = alcGetString(nullptr, specifier);
-  while (*devices != 0) {
-    callback(devices);
-    while (*devices != 0) {
-      ++devices;
-    }
-    ++devices;
-  }
-}
-
 int DevicesCount(ALCenum specifier) {
-  auto result = 0;
-  EnumerateDevices(specifier, [&](const char* device) { ++result; });
-
-  return result;
+  return AudioDeviceRegistry::Count(specifier);
 }
 
 std::string GetDefaultDeviceId(ALCenum specifier) {
@@ -191,31 +208,7 @@ int DeviceName(ALCenum specifier,
                int index,
                std::string* name,
                std::string* guid) {
-  EnumerateDevices(specifier, [&](const char* device_name_str) {
-    if (index < 0) {
-      return;
-    } else if (index > 0) {
-      --index;
-      return;
-    }
-
-    auto device_name = std::string(device_name_str);
-    if (name) {
-      if (guid) {
-        *guid = device_name;
-      }
-      const auto prefix = std::string("OpenAL Soft on ");
-      if (device_name.rfind(prefix, 0) == 0) {
-        device_name = device_name.substr(prefix.size());
-      }
-      *name = std::move(device_name);
-    } else if (guid) {
-      *guid = std::move(device_name);
-    }
-    index = -1;
-  });
-
-  return (index > 0) ? -1 : 0;
+  return AudioDeviceRegistry::Get(specifier, index, name, guid) ? 0 : -1;
 }
 
 void SetStringToArray(const std::string& string, char* array, int size) {
@@ -266,11 +259,14 @@ int OpenALAudioDeviceModule::restartPlayout() {
   if (!validatePlayoutDeviceId()) {
     _data->_playoutThread->BlockingCall([this] {
       _data->playing = true;
+      setState(kPlaying, true);
       _playoutFailed = true;
     });
     return 0;
   }
   _playoutFailed = false;
+  // `stopPlayingOnThread()` stops the `_playoutThread`.
+  _data->_playoutThread->Start();
   openPlayoutDevice();
   startPlayingOnThread();
 
@@ -295,6 +291,7 @@ int32_t OpenALAudioDeviceModule::InitPlayout() {
     return 0;
   }
   _playoutInitialized = true;
+  setState(kPlayoutInitialized, true);
 
   ensureThreadStarted();
 
@@ -302,7 +299,7 @@ int32_t OpenALAudioDeviceModule::InitPlayout() {
 }
 
 bool OpenALAudioDeviceModule::PlayoutIsInitialized() const {
-  return _playoutInitialized;
+  return hasState(kPlayoutInitialized);
 }
 
 int32_t OpenALAudioDeviceModule::StartPlayout() {
@@ -339,21 +336,23 @@ int32_t OpenALAudioDeviceModule::StopPlayout() {
   }
   closePlayoutDevice();
   _playoutInitialized = false;
+  setState(kPlayoutInitialized | kPlaying, false);
 
   return 0;
 }
 
 bool OpenALAudioDeviceModule::Playing() const {
-  return _data && _data->playing;
+  return hasState(kPlaying);
 }
 
 int32_t OpenALAudioDeviceModule::InitSpeaker() {
   _speakerInitialized = true;
+  setState(kSpeakerInitialized, true);
   return 0;
 }
 
 bool OpenALAudioDeviceModule::SpeakerIsInitialized() const {
-  return _speakerInitialized;
+  return hasState(kSpeakerInitialized);
 }
 
 int32_t OpenALAudioDeviceModule::StereoPlayoutIsAvailable(
@@ -369,23 +368,93 @@ int32_t OpenALAudioDeviceModule::SetStereoPlayout(bool enable) {
     return -1;
   }
   _playoutChannels = enable ? 2 : 1;
+  setState(kStereoPlayout, enable);
   return 0;
 }
 
 int32_t OpenALAudioDeviceModule::StereoPlayout(bool* enabled) const {
   if (enabled) {
-    *enabled = (_playoutChannels == 2);
+    *enabled = hasState(kStereoPlayout);
   }
   return 0;
 }
 
+int32_t OpenALAudioDeviceModule::SetPlayoutBufferDepth(uint16_t buffers) {
+  if (buffers < kMinBuffersKeepReadyCount ||
+      buffers > kMaxBuffersKeepReadyCount) {
+    return -1;
+  }
+
+  {
+    std::lock_guard<std::recursive_mutex> lk(_playout_mutex);
+
+    if (_playoutBuffersKeepReady == buffers) {
+      return 0;
+    }
+    _playoutBuffersKeepReady = buffers;
+  }
+
+  return restartPlayout();
+}
+
+void OpenALAudioDeviceModule::CallAsync(
+    absl::AnyInvocable<void(ExtendedADM&) &&> task) {
+  std::move(task)(*this);
+}
+
 int32_t OpenALAudioDeviceModule::PlayoutDelay(uint16_t* delayMS) const {
   if (delayMS) {
-    *delayMS = 0;
+    *delayMS = uint16_t(std::clamp(_playoutDelayMs.load(), 0, 0xFFFF));
   }
   return 0;
 }
 
+absl::optional<webrtc::AudioDeviceModule::Stats>
+OpenALAudioDeviceModule::GetStats() const {
+  std::lock_guard<std::mutex> lk(_stats_mutex);
+
+  return _stats;
+}
+
+void OpenALAudioDeviceModule::processRenderedSamples() {
+  std::lock_guard<std::mutex> lk(_render_mutex);
+
+  if (_renderProcessors.empty()) {
+    return;
+  }
+
+  const auto config = webrtc::StreamConfig(kPlayoutFrequency, _playoutChannels);
+  const auto samples =
+      reinterpret_cast<int16_t*>(_data->playoutSamples->data());
+  _renderedSamples.resize(_data->playoutSamples->size() / sizeof(int16_t));
+  for (const auto& audioProcessing : _renderProcessors) {
+    audioProcessing->ProcessReverseStream(samples, config, config,
+                                          _renderedSamples.data());
+  }
+}
+
+void OpenALAudioDeviceModule::updatePlayoutDelay(
+    std::chrono::milliseconds latency) {
+  const auto measured = double(latency.count());
+  _smoothedPlayoutDelayMs =
+      _smoothedPlayoutDelayMs
+          ? _smoothedPlayoutDelayMs +
+                (measured - _smoothedPlayoutDelayMs) * kLatencySmoothingFactor
+          : measured;
+  const auto delay = int(std::lround(_smoothedPlayoutDelayMs));
+  _playoutDelayMs = delay;
+
+  // AEC and A/V sync use the total delay of the audio path between rendering
+  // the far-end audio and capturing it back.
+  audio_device_buffer_->SetVQEData(delay, _recordingDelayMs.load());
+
+  std::lock_guard<std::mutex> lk(_stats_mutex);
+  const auto duration = double(kPlayoutPart) / kPlayoutFrequency;
+  _stats.total_samples_count += kPlayoutPart;
+  _stats.total_samples_duration_s += duration;
+  _stats.total_playout_delay_s += kPlayoutPart * (delay / 1000.);
+}
+
 int32_t OpenALAudioDeviceModule::SpeakerVolumeIsAvailable(bool* available) {
   if (available) {
     *available = false;
@@ -466,10 +535,18 @@ void OpenALAudioDeviceModule::ensureThreadStarted() {
 
   _data = std::make_unique<Data>();
   processPlayoutQueued();
-  processRecordingQueued();
+  _recordersChanged = true;
+  processRecordingQueued(std::chrono::milliseconds(kProcessInterval));
 }
 
+// Polls the playout buffers every 10 ms.
+//
+// When the playout is driven by `AL_SOFT_events`, it's only a watchdog waking
+// up once per the whole queue duration, in case an event is lost.
 void OpenALAudioDeviceModule::processPlayoutQueued() {
+  const auto interval = _data->eventsEnabled
+                            ? kBufferSizeMs * _data->buffersKeepReady
+                            : kBufferSizeMs;
   _data->_playoutThread->PostDelayedHighPrecisionTask(
       [=] {
         std::lock_guard<std::recursive_mutex> lk(_playout_mutex);
@@ -477,7 +554,90 @@ void OpenALAudioDeviceModule::processPlayoutQueued() {
         processPlayout();
         processPlayoutQueued();
       },
-      webrtc::TimeDelta::Millis(10));
+      webrtc::TimeDelta::Millis(interval));
+}
+
+bool OpenALAudioDeviceModule::enablePlayoutEvents() {
+  if (!alEventCallbackSOFT || !alEventControlSOFT ||
+      !kAL_EVENT_TYPE_BUFFER_COMPLETED_SOFT ||
+      !kAL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT) {
+    return false;
+  }
+
+  alGetError();
+  const ALenum types[] = {kAL_EVENT_TYPE_BUFFER_COMPLETED_SOFT,
+                          kAL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT};
+  alEventControlSOFT(2, types, AL_TRUE);
+  if (kAL_EVENT_TYPE_DISCONNECTED_SOFT) {
+    alEventControlSOFT(1, &kAL_EVENT_TYPE_DISCONNECTED_SOFT, AL_TRUE);
+  }
+  alEventCallbackSOFT(&OpenALAudioDeviceModule::onPlayoutEvent, this);
+  if (alGetError() != AL_NO_ERROR) {
+    alEventCallbackSOFT(nullptr, nullptr);
+    return false;
+  }
+
+  return true;
+}
+
+void OpenALAudioDeviceModule::disablePlayoutEvents() {
+  if (!_data->eventsEnabled) {
+    return;
+  }
+
+  // The callback references `_data`, so it must be reset synchronously,
+  // before `_data` may be destroyed. The context it's registered on is only
+  // current on the `_playoutThread`.
+  _data->_playoutThread->BlockingCall([this] {
+    alEventCallbackSOFT(nullptr, nullptr);
+    _data->eventsEnabled = false;
+  });
+}
+
+void OpenALAudioDeviceModule::schedulePlayoutRefill() {
+  if (_data->refillPending.exchange(true)) {
+    return;
+  }
+
+  _data->_playoutThread->PostTask([this] {
+    std::lock_guard<std::recursive_mutex> lk(_playout_mutex);
+
+    _data->refillPending = false;
+    _data->completedBuffers = 0;
+    processPlayout();
+  });
+}
+
+void OpenALAudioDeviceModule::onPlayoutEvent(ALenum eventType,
+                                             ALuint object,
+                                             ALuint param,
+                                             ALsizei length,
+                                             const ALchar* message,
+                                             void* userParam) {
+  auto adm = static_cast<OpenALAudioDeviceModule*>(userParam);
+  if (!adm->_data) {
+    return;
+  }
+  auto& data = *adm->_data;
+
+  if (eventType == kAL_EVENT_TYPE_BUFFER_COMPLETED_SOFT) {
+    // Refilling in batches of half the queue halves the wakeups, while still
+    // keeping at least half of the queue ready to be played.
+    const auto batch = std::max(data.buffersKeepReady / 2, 1);
+    if (data.completedBuffers.fetch_add(int(param)) + int(param) >= batch) {
+      adm->schedulePlayoutRefill();
+    }
+  } else if (eventType == kAL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT) {
+    // The source has stopped because of an underrun, so it should be refilled
+    // and restarted right away.
+    if (ALenum(param) == AL_STOPPED) {
+      adm->schedulePlayoutRefill();
+    }
+  } else if (eventType == kAL_EVENT_TYPE_DISCONNECTED_SOFT) {
+    RTC_LOG(LS_ERROR) << "OpenAL playout device disconnected: "
+                      << std::string(message, length);
+    adm->schedulePlayoutRefill();
+  }
 }
 
 bool CheckDeviceFailed(ALCdevice* device) {
@@ -527,6 +687,10 @@ int32_t OpenALAudioDeviceModule::RegisterAudioCallback(
 }
 
 bool OpenALAudioDeviceModule::processPlayout() {
+  if (!_data->source) {
+    return false;
+  }
+
   const auto playing = [&] {
     auto state = ALint(AL_INITIAL);
     alGetSourcei(_data->source, AL_SOURCE_STATE, &state);
@@ -540,12 +704,14 @@ bool OpenALAudioDeviceModule::processPlayout() {
     unqueueAllBuffers();
   }
 
-  const auto wereQueued = _data->queuedBuffers;
-  while (_data->queuedBuffersCount < kBuffersKeepReadyCount) {
+  std::fill(_data->refilledBuffers.begin(), _data->refilledBuffers.end(),
+            false);
+  while (_data->queuedBuffersCount < _data->buffersKeepReady) {
     const auto available =
         audio_device_buffer_->RequestPlayoutData(kPlayoutPart);
     if (available == kPlayoutPart) {
       audio_device_buffer_->GetPlayoutData(_data->playoutSamples->data());
+      processRenderedSamples();
     } else {
       std::fill(_data->playoutSamples->begin(), _data->playoutSamples->end(),
                 0);
@@ -554,6 +720,7 @@ bool OpenALAudioDeviceModule::processPlayout() {
 
     _playoutLatency = countExactQueuedMsForLatency(
         std::chrono::steady_clock::now(), wasPlaying);
+    updatePlayoutDelay(_playoutLatency);
 
     const auto i = std::find(std::begin(_data->queuedBuffers),
                              std::end(_data->queuedBuffers), false);
@@ -565,6 +732,7 @@ bool OpenALAudioDeviceModule::processPlayout() {
         kPlayoutFrequency);
 
     _data->queuedBuffers[index] = true;
+    _data->refilledBuffers[index] = true;
     ++_data->queuedBuffersCount;
     if (wasPlaying) {
       alSourceQueueBuffers(_data->source, 1, _data->buffers.data() + index);
@@ -580,7 +748,7 @@ bool OpenALAudioDeviceModule::processPlayout() {
       // we queued right now.
       unqueueAllBuffers();
       for (auto i = 0; i != int(_data->buffers.size()); ++i) {
-        if (!wereQueued[i] && _data->queuedBuffers[i]) {
+        if (_data->refilledBuffers[i]) {
           alSourceQueueBuffers(_data->source, 1, _data->buffers.data() + i);
         }
       }
@@ -611,13 +779,8 @@ void OpenALAudioDeviceModule::closePlayoutDevice() {
 }
 
 bool OpenALAudioDeviceModule::validatePlayoutDeviceId() {
-  auto valid = false;
-  EnumerateDevices(ALC_ALL_DEVICES_SPECIFIER, [&](const char* device) {
-    if (!valid && _playoutDeviceId == std::string(device)) {
-      valid = true;
-    }
-  });
-  if (valid) {
+  if (AudioDeviceRegistry::Contains(ALC_ALL_DEVICES_SPECIFIER,
+                                    _playoutDeviceId)) {
     return true;
   }
   const auto defaultDeviceId = GetDefaultDeviceId(ALC_DEFAULT_DEVICE_SPECIFIER);
@@ -636,6 +799,7 @@ void OpenALAudioDeviceModule::startPlayingOnThread() {
     std::lock_guard<std::recursive_mutex> lk(_playout_mutex);
 
     _data->playing = true;
+    setState(kPlaying, true);
     if (_playoutFailed) {
       return;
     }
@@ -654,6 +818,11 @@ void OpenALAudioDeviceModule::startPlayingOnThread() {
                   alGetEnumValue("AL_REMIX_UNMATCHED_SOFT"));
       }
       _data->source = source;
+      _data->buffersKeepReady = _playoutBuffersKeepReady;
+      _data->buffers.assign(_data->buffersKeepReady + kBuffersSpareCount, 0);
+      _data->queuedBuffers.assign(_data->buffers.size(), false);
+      _data->refilledBuffers.assign(_data->buffers.size(), false);
+      _data->queuedBuffersCount = 0;
       alGenBuffers(_data->buffers.size(), _data->buffers.data());
 
       _data->exactDeviceTimeCounter = 0;
@@ -662,12 +831,20 @@ void OpenALAudioDeviceModule::startPlayingOnThread() {
 
       const auto bufferSize = kPlayoutPart * sizeof(int16_t) * _playoutChannels;
 
+      _data->eventsEnabled = enablePlayoutEvents();
+      if (!_data->eventsEnabled) {
+        RTC_LOG(LS_INFO) << "`AL_SOFT_events` are unavailable, polling the "
+                            "OpenAL playout queue instead.";
+      }
+
       ensureThreadStarted();
+      processPlayout();
     }
   });
 }
 
 void OpenALAudioDeviceModule::stopPlayingOnThread() {
+  disablePlayoutEvents();
   {
     std::lock_guard<std::recursive_mutex> lk(_playout_mutex);
 
@@ -680,6 +857,7 @@ void OpenALAudioDeviceModule::stopPlayingOnThread() {
       return;
     }
     _data->playing = false;
+    setState(kPlaying, false);
     if (_playoutFailed) {
       _data->_playoutThread->PostTask([this] {
         std::lock_guard<std::recursive_mutex> lk(_playout_mutex);
@@ -702,9 +880,18 @@ void OpenALAudioDeviceModule::stopPlayingOnThread() {
 }
 
 rtc::scoped_refptr<bridge::LocalAudioSource>
-OpenALAudioDeviceModule::CreateAudioSource(uint32_t device_index) {
+OpenALAudioDeviceModule::CreateAudioSource(uint32_t device_index,
+                                           RecordingFormat format,
+                                           cricket::AudioOptions options) {
   std::lock_guard<std::recursive_mutex> lk(_recording_mutex);
 
+  if (!format.IsValid()) {
+    RTC_LOG(LS_ERROR) << "Unsupported recording format: "
+                      << format.sampleRate << " Hz, " << format.channels
+                      << " channels, " << format.ringSizeMs << " ms ring";
+    return nullptr;
+  }
+
   std::string deviceId;
   const auto result = DeviceName(ALC_CAPTURE_DEVICE_SPECIFIER, device_index,
                                  nullptr, &deviceId);
@@ -712,10 +899,24 @@ OpenALAudioDeviceModule::CreateAudioSource(uint32_t device_index) {
     return nullptr;
   }
 
-  auto recorder = std::make_unique<AudioDeviceRecorder>(deviceId);
+  // Replacing a recorder would leave its `AudioProcessing` referenced against
+  // the playout, while its `bridge::LocalAudioSource` keeps being used.
+  if (_recorders.find(deviceId) != _recorders.end()) {
+    RTC_LOG(LS_ERROR) << "Audio device `" << deviceId
+                      << "` is being recorded already";
+    return nullptr;
+  }
+
+  auto recorder =
+      std::make_shared<AudioDeviceRecorder>(deviceId, format, options);
   recorder->StartCapture();
   auto source = recorder->GetSource();
+  {
+    std::lock_guard<std::mutex> render_lk(_render_mutex);
+    _renderProcessors.push_back(recorder->GetAudioProcessing());
+  }
   _recorders[deviceId] = std::move(recorder);
+  _recordersChanged = true;
 
   return source;
 }
@@ -727,7 +928,15 @@ void OpenALAudioDeviceModule::DisposeAudioSource(std::string device_id) {
   if (it != _recorders.end()) {
     auto recorder = std::move(it->second);
     recorder->StopCapture();
+    {
+      std::lock_guard<std::mutex> render_lk(_render_mutex);
+      _renderProcessors.erase(
+          std::remove(_renderProcessors.begin(), _renderProcessors.end(),
+                      recorder->GetAudioProcessing()),
+          _renderProcessors.end());
+    }
     _recorders.erase(it);
+    _recordersChanged = true;
   }
 }
 
@@ -743,27 +952,59 @@ void OpenALAudioDeviceModule::stopCaptureOnThread() {
       std::lock_guard<std::recursive_mutex> lk(_recording_mutex);
 
       _data->recording = false;
+      setState(kRecording, false);
       for (const auto& [_, recorder] : _recorders) {
         recorder->StopCapture();
       }
     });
   }
   _data->_recordingThread->Stop();
+  setState(kRecording, false);
 }
 
-void OpenALAudioDeviceModule::processRecordingQueued() {
+// Schedules the next processing of the `_recorders`.
+//
+// The recording thread acts as a reactor servicing every device on its own: it
+// wakes up once any of them is expected to have the next part available, rather
+// than on a fixed interval.
+void OpenALAudioDeviceModule::processRecordingQueued(
+    std::chrono::microseconds delay) {
   _data->_recordingThread->PostDelayedHighPrecisionTask(
-      [=] {
-        std::lock_guard<std::recursive_mutex> lk(_recording_mutex);
+      [=] { processRecordingQueued(processRecorders()); },
+      webrtc::TimeDelta::Micros(delay.count()));
+}
 
-        for (const auto& [_, recorder] : _recorders) {
-          for (auto first = true; recorder->ProcessRecordedPart(first);
-               first = false) {
-          }
-        }
-        processRecordingQueued();
-      },
-      webrtc::TimeDelta::Millis(kProcessInterval));
+std::chrono::microseconds OpenALAudioDeviceModule::processRecorders() {
+  if (_recordersChanged.exchange(false)) {
+    std::lock_guard<std::recursive_mutex> lk(_recording_mutex);
+
+    _processedRecorders.clear();
+    for (const auto& [_, recorder] : _recorders) {
+      _processedRecorders.push_back(recorder);
+    }
+  }
+
+  const auto playoutDelay = std::chrono::milliseconds(_playoutDelayMs.load());
+  std::chrono::microseconds nextDelay =
+      std::chrono::milliseconds(kProcessInterval);
+  auto recordingDelay = std::chrono::milliseconds(0);
+  for (const auto& recorder : _processedRecorders) {
+    // Parts recorded per device are limited, so a device with a backlog
+    // catches up over the next cycles instead of delaying the others.
+    auto parts = 0;
+    while (parts < kMaxRecordedPartsPerCycle &&
+           recorder->ProcessRecordedPart(parts == 0, playoutDelay)) {
+      ++parts;
+    }
+    nextDelay = parts == kMaxRecordedPartsPerCycle
+                    ? std::chrono::microseconds(0)
+                    : std::min(nextDelay, recorder->NextPartDelay());
+    recordingDelay = std::max(recordingDelay, recorder->Latency());
+  }
+  _recordingDelayMs = int(recordingDelay.count());
+
+  return std::max<std::chrono::microseconds>(
+      nextDelay, std::chrono::milliseconds(kMinProcessInterval));
 }
 
 void OpenALAudioDeviceModule::startCaptureOnThread() {
@@ -772,7 +1013,9 @@ void OpenALAudioDeviceModule::startCaptureOnThread() {
     std::lock_guard<std::recursive_mutex> lk(_recording_mutex);
 
     _data->recording = true;
-    processRecordingQueued();
+    setState(kRecording, true);
+    _recordersChanged = true;
+    processRecordingQueued(std::chrono::milliseconds(kProcessInterval));
   });
 }
 
@@ -821,13 +1064,14 @@ int32_t OpenALAudioDeviceModule::InitRecording() {
     return 0;
   }
   _recordingInitialized = true;
+  setState(kRecordingInitialized, true);
   ensureThreadStarted();
 
   return 0;
 }
 
 bool OpenALAudioDeviceModule::RecordingIsInitialized() const {
-  return _recordingInitialized;
+  return hasState(kRecordingInitialized);
 }
 
 int32_t OpenALAudioDeviceModule::StartRecording() {
@@ -848,16 +1092,17 @@ int32_t OpenALAudioDeviceModule::StopRecording() {
 }
 
 bool OpenALAudioDeviceModule::Recording() const {
-  return _data && _data->recording;
+  return hasState(kRecording);
 }
 
 int32_t OpenALAudioDeviceModule::InitMicrophone() {
   _microphoneInitialized = true;
+  setState(kMicrophoneInitialized, true);
   return 0;
 }
 
 bool OpenALAudioDeviceModule::MicrophoneIsInitialized() const {
-  return _microphoneInitialized;
+  return hasState(kMicrophoneInitialized);
 }
 
 int32_t OpenALAudioDeviceModule::MicrophoneVolumeIsAvailable(bool* available) {
@@ -925,7 +1170,9 @@ int32_t OpenALAudioDeviceModule::StereoRecording(bool* enabled) const {
 std::chrono::milliseconds OpenALAudioDeviceModule::countExactQueuedMsForLatency(
     std::chrono::time_point<std::chrono::steady_clock> now,
     bool playing) {
-  auto now_nanos = now.time_since_epoch().count();
+  auto now_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       now.time_since_epoch())
+                       .count();
   auto values = std::array<AL_INT64_TYPE, kALMaxValues>{};
   auto& sampleOffset = values[0];
   auto& clockTime = values[1];
@@ -944,9 +1191,8 @@ std::chrono::milliseconds OpenALAudioDeviceModule::countExactQueuedMsForLatency(
                           values.data());
 
       // `exactDeviceTime` is in nanoseconds.
-      exactDeviceTime =
-          _data->lastExactDeviceTime +
-          (now_nanos - _data->lastExactDeviceTimeWhen) * 1'000'000;
+      exactDeviceTime = _data->lastExactDeviceTime +
+                        (now_nanos - _data->lastExactDeviceTimeWhen);
     }
   } else {
     auto offset = ALint(0);
@@ -963,7 +1209,7 @@ std::chrono::milliseconds OpenALAudioDeviceModule::countExactQueuedMsForLatency(
       (double((queuedSamples - processedInOpenAL) >> (32 - 10)) /
        double(kPlayoutFrequency * (1 << 10)));
 
-  const auto queuedTotal = std::chrono::duration<double>(
+  const auto queuedTotal = std::chrono::duration<double, std::milli>(
       (secondsQueuedInDevice + secondsQueuedInOpenAL) * 1'000);
 
   auto res =
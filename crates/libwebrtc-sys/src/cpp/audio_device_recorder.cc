@@ -2,23 +2,41 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <optional>
 #include <vector>
 #include "api/make_ref_counted.h"
 #include "audio_device_recorder.h"
+#include "audio_device_registry.h"
+#include "common_audio/include/audio_util.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
 
 namespace recorder {
 
-template <typename Callback>
-void EnumerateDevices(ALCenum specifier, Callback&& callback) {
-  auto devices = alcGetString(nullptr, specifier);
-  while (*devices != 0) {
-    callback(devices);
-    while (*devices != 0) {
-      ++devices;
-    }
-    ++devices;
+using ALCGETINTEGER64VSOFT = void (*)(ALCdevice* device,
+                                      ALCenum pname,
+                                      ALsizei size,
+                                      std::int64_t* values);
+
+// Returns the latency of the provided capture device, if the
+// `ALC_SOFT_device_clock` extension is available.
+std::optional<std::chrono::nanoseconds> DeviceLatency(ALCdevice* device) {
+  static const auto alcGetInteger64vSOFT = (ALCGETINTEGER64VSOFT)
+      alcGetProcAddress(nullptr, "alcGetInteger64vSOFT");
+  static const auto kALC_DEVICE_LATENCY_SOFT =
+      alcGetEnumValue(nullptr, "ALC_DEVICE_LATENCY_SOFT");
+
+  if (!device || !alcGetInteger64vSOFT || !kALC_DEVICE_LATENCY_SOFT) {
+    return std::nullopt;
+  }
+
+  auto latency = std::int64_t(0);
+  alcGetInteger64vSOFT(device, kALC_DEVICE_LATENCY_SOFT, 1, &latency);
+  if (alcGetError(device) != ALC_NO_ERROR) {
+    return std::nullopt;
   }
+  return std::chrono::nanoseconds(latency);
 }
 
 std::string GetDefaultDeviceId(ALCenum specifier) {
@@ -35,19 +53,122 @@ bool CheckDeviceFailed(ALCdevice* device) {
 
   return false;
 }
+
+// Returns the OpenAL format of the provided `RecordingFormat`, or `0` if it's
+// not supported.
+//
+// Capture devices have no AL context, so the `AL_EXT_float32` formats are
+// resolved via `alcGetEnumValue()`, which doesn't require a current one.
+ALenum ALFormat(const RecordingFormat& format) {
+  const auto stereo = format.channels == 2;
+  if (format.sampleFormat == RecordingSampleFormat::kFloat32) {
+    return alcGetEnumValue(nullptr, stereo ? "AL_FORMAT_STEREO_FLOAT32"
+                                           : "AL_FORMAT_MONO_FLOAT32");
+  }
+  return stereo ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16;
+}
+
+// Returns the size of a single sample of the provided `RecordingSampleFormat`.
+size_t SampleSize(RecordingSampleFormat format) {
+  return format == RecordingSampleFormat::kFloat32 ? sizeof(float)
+                                                   : sizeof(int16_t);
+}
+
+// Returns the sample rate natively supported by the `AudioProcessing` the
+// audio recorded with the provided sample rate should be resampled to.
+int OutputFrequency(int sampleRate) {
+  switch (sampleRate) {
+    case 8000:
+    case 16000:
+    case 32000:
+    case 48000:
+      return sampleRate;
+    default:
+      return kRecordingFrequency;
+  }
+}
+
+// Opens the capture device with the provided ID in the provided
+// `RecordingFormat`.
+ALCdevice* OpenCaptureDevice(const std::string& deviceId,
+                             const RecordingFormat& format) {
+  return alcCaptureOpenDevice(deviceId.empty() ? nullptr : deviceId.c_str(),
+                              format.sampleRate, ALFormat(format),
+                              format.sampleRate * format.ringSizeMs / 1000);
+}
+
+// Creates a new `AudioProcessing` for the audio recorded with the provided
+// `AudioOptions`.
+//
+// Audio processing components not explicitly disabled are enabled.
+rtc::scoped_refptr<webrtc::AudioProcessing> CreateAudioProcessing(
+    const cricket::AudioOptions& options) {
+  auto audioProcessing = webrtc::AudioProcessingBuilder().Create();
+
+  auto config = webrtc::AudioProcessing::Config();
+  config.echo_canceller.enabled = options.echo_cancellation.value_or(true);
+  config.noise_suppression.enabled = options.noise_suppression.value_or(true);
+  config.noise_suppression.level =
+      webrtc::AudioProcessing::Config::NoiseSuppression::kHigh;
+  config.gain_controller1.enabled = options.auto_gain_control.value_or(true);
+  config.gain_controller1.mode =
+      webrtc::AudioProcessing::Config::GainController1::kAdaptiveDigital;
+  config.high_pass_filter.enabled = options.highpass_filter.value_or(true);
+  audioProcessing->ApplyConfig(config);
+
+  return audioProcessing;
+}
+
 }  // namespace recorder
 
-AudioDeviceRecorder::AudioDeviceRecorder(std::string deviceId) {
-  _device = alcCaptureOpenDevice(deviceId.empty() ? nullptr : deviceId.c_str(),
-                                 kRecordingFrequency, AL_FORMAT_MONO16,
-                                 kRecordingFrequency);
-  _source = bridge::LocalAudioSource::Create(cricket::AudioOptions());
+AudioDeviceRecorder::AudioDeviceRecorder(std::string deviceId,
+                                         RecordingFormat format,
+                                         cricket::AudioOptions options)
+    : _format(format) {
+  if (_format.sampleFormat == RecordingSampleFormat::kFloat32 &&
+      recorder::ALFormat(_format) == 0) {
+    RTC_LOG(LS_WARNING) << "Float32 audio recording is not supported, "
+                           "falling back to Int16";
+    _format.sampleFormat = RecordingSampleFormat::kInt16;
+  }
+
+  _recordingPart = (_format.sampleRate * kBufferSizeMs + 999) / 1000;
+  _outputFrequency = recorder::OutputFrequency(_format.sampleRate);
+
+  const auto samples = size_t(_recordingPart * _format.channels);
+  if (_format.sampleFormat != RecordingSampleFormat::kInt16 ||
+      _outputFrequency != _format.sampleRate) {
+    _capturedSamples.resize(samples *
+                            recorder::SampleSize(_format.sampleFormat));
+  }
+  if (_format.sampleFormat != RecordingSampleFormat::kInt16 &&
+      _outputFrequency != _format.sampleRate) {
+    _convertedSamples.resize(samples);
+  }
+  const auto outputPart = size_t(_outputFrequency * kBufferSizeMs / 1000);
+  _recordedSamples.resize(outputPart * _format.channels);
+  _compensatedSamples.resize(outputPart * _format.channels);
+  _driftCompensator = std::make_unique<DriftCompensator>(
+      _format.sampleRate, outputPart, _format.channels);
+  _resampler.InitializeIfNeeded(_format.sampleRate, _outputFrequency,
+                                _format.channels);
+
+  _device = recorder::OpenCaptureDevice(deviceId, _format);
+  _source = bridge::LocalAudioSource::Create(options);
+  _audioProcessing = recorder::CreateAudioProcessing(_source->options());
   _deviceId = deviceId;
 }
 
-bool AudioDeviceRecorder::ProcessRecordedPart(bool isFirstInCycle) {
+bool AudioDeviceRecorder::ProcessRecordedPart(
+    bool isFirstInCycle,
+    std::chrono::milliseconds playoutDelay) {
   std::lock_guard<std::recursive_mutex> lk(_mutex);
 
+  _nextPartDelay = std::chrono::milliseconds(kBufferSizeMs);
+  if (!_recording || _recordingFailed || !_device) {
+    return false;
+  }
+
   auto samples = ALint();
   alcGetIntegerv(_device, ALC_CAPTURE_SAMPLES, 1, &samples);
 
@@ -64,27 +185,66 @@ bool AudioDeviceRecorder::ProcessRecordedPart(bool isFirstInCycle) {
       }
     }
     return false;
-  } else if (samples < kRecordingPart) {
+  } else if (samples < _recordingPart) {
     // Not enough data for 10 milliseconds.
+    _nextPartDelay = std::chrono::microseconds(
+        (_recordingPart - samples) * rtc::kNumMicrosecsPerSec /
+        _format.sampleRate);
     return false;
   }
 
   _emptyRecordingData = 0;
-  alcCaptureSamples(_device, _recordedSamples->data(), kRecordingPart);
+  updateLatency(samples);
+  _driftCompensator->UpdateClock(rtc::TimeMicros(), _recordedFrames + samples);
+  // Samples requiring no conversion are captured right into the output.
+  alcCaptureSamples(_device,
+                    _capturedSamples.empty()
+                        ? static_cast<void*>(_recordedSamples.data())
+                        : static_cast<void*>(_capturedSamples.data()),
+                    _recordingPart);
 
   if (checkDeviceFailed()) {
     restartRecording();
     return false;
   }
+  _recordedFrames += _recordingPart;
+  _nextPartDelay = std::chrono::microseconds(0);
 
-  _source->OnData(_recordedSamples->data(),  // audio_data
-                  16,
-                  kRecordingFrequency,  // sample_rate
-                  kRecordingChannels, kRecordingFrequency * 10 / 1000);
+  convertRecordedSamples();
+  _driftCompensator->Push(_recordedSamples.data(),
+                          _outputFrequency * kBufferSizeMs / 1000);
+  emitCompensatedSamples(playoutDelay);
 
   return true;
 }
 
+std::chrono::microseconds AudioDeviceRecorder::NextPartDelay() const {
+  return _nextPartDelay;
+}
+
+// Processes and propagates to the `_source` all the 10 ms frames the
+// `_driftCompensator` has buffered enough samples for.
+void AudioDeviceRecorder::emitCompensatedSamples(
+    std::chrono::milliseconds playoutDelay) {
+  while (true) {
+    // The oldest of the buffered samples has been waiting for the whole
+    // latency since it was captured by the device.
+    const auto captureTimestampMs = rtc::TimeMillis() - Latency().count() -
+                                    _driftCompensator->buffered_ms();
+    if (!_driftCompensator->Pop(_compensatedSamples.data())) {
+      return;
+    }
+
+    processRecordedSamples(playoutDelay);
+
+    _source->OnData(_compensatedSamples.data(),  // audio_data
+                    16,
+                    _outputFrequency,  // sample_rate
+                    _format.channels, _outputFrequency * kBufferSizeMs / 1000,
+                    captureTimestampMs);
+  }
+}
+
 void AudioDeviceRecorder::StopCapture() {
   std::lock_guard<std::recursive_mutex> lk(_mutex);
 
@@ -124,6 +284,80 @@ rtc::scoped_refptr<bridge::LocalAudioSource> AudioDeviceRecorder::GetSource() {
   return _source;
 }
 
+rtc::scoped_refptr<webrtc::AudioProcessing>
+AudioDeviceRecorder::GetAudioProcessing() {
+  return _audioProcessing;
+}
+
+// Converts the just captured samples into the `_recordedSamples`, if they
+// aren't captured there directly.
+void AudioDeviceRecorder::convertRecordedSamples() {
+  if (_capturedSamples.empty()) {
+    return;
+  }
+
+  const auto samples = size_t(_recordingPart * _format.channels);
+  auto converted = reinterpret_cast<const int16_t*>(_capturedSamples.data());
+  if (_format.sampleFormat == RecordingSampleFormat::kFloat32) {
+    const auto floats = reinterpret_cast<const float*>(_capturedSamples.data());
+    const auto output = _convertedSamples.empty() ? _recordedSamples.data()
+                                                  : _convertedSamples.data();
+    webrtc::FloatToS16(floats, samples, output);
+    if (_convertedSamples.empty()) {
+      return;
+    }
+    converted = output;
+  }
+
+  if (_resampler.Resample(converted, samples, _recordedSamples.data(),
+                          _recordedSamples.size()) < 0) {
+    RTC_LOG(LS_WARNING) << "Failed to resample recorded audio";
+  }
+}
+
+// Processes the compensated samples in place with the `_audioProcessing`.
+void AudioDeviceRecorder::processRecordedSamples(
+    std::chrono::milliseconds playoutDelay) {
+  const auto config = webrtc::StreamConfig(_outputFrequency, _format.channels);
+  const auto samples = _compensatedSamples.data();
+
+  // Total delay between rendering the far-end audio by the playout device and
+  // capturing its echo back here.
+  _audioProcessing->set_stream_delay_ms(
+      int((playoutDelay + Latency()).count()));
+
+  const auto result =
+      _audioProcessing->ProcessStream(samples, config, config, samples);
+  if (result != webrtc::AudioProcessing::kNoError) {
+    RTC_LOG(LS_WARNING) << "Failed to process recorded audio: " << result;
+  }
+}
+
+std::chrono::milliseconds AudioDeviceRecorder::Latency() const {
+  return std::chrono::milliseconds(_latencyMs.load());
+}
+
+// Updates the smoothed latency with the one of the oldest of the
+// `queuedSamples` waiting in the OpenAL capture ring.
+void AudioDeviceRecorder::updateLatency(ALint queuedSamples) {
+  const auto queued = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::milliseconds(1000) * queuedSamples / _format.sampleRate);
+  const auto device = recorder::DeviceLatency(_device);
+
+  const auto measured =
+      device ? queued + std::chrono::duration_cast<std::chrono::milliseconds>(
+                            *device)
+             : std::max(queued, kDefaultRecordingLatency);
+
+  const auto value = double(measured.count());
+  _smoothedLatencyMs =
+      _smoothedLatencyMs
+          ? _smoothedLatencyMs +
+                (value - _smoothedLatencyMs) * kLatencySmoothingFactor
+          : value;
+  _latencyMs = int(std::lround(_smoothedLatencyMs));
+}
+
 bool AudioDeviceRecorder::checkDeviceFailed() {
   if (auto code = alcGetError(_device); code != ALC_NO_ERROR) {
     RTC_LOG(LS_ERROR) << "OpenAL Error " << code << ": "
@@ -135,14 +369,7 @@ bool AudioDeviceRecorder::checkDeviceFailed() {
 }
 
 bool AudioDeviceRecorder::validateRecordingDeviceId() {
-  auto valid = false;
-  recorder::EnumerateDevices(ALC_CAPTURE_DEVICE_SPECIFIER,
-                             [&](const char* device) {
-                               if (!valid && _deviceId == std::string(device)) {
-                                 valid = true;
-                               }
-                             });
-  if (valid) {
+  if (AudioDeviceRegistry::Contains(ALC_CAPTURE_DEVICE_SPECIFIER, _deviceId)) {
     return true;
   }
   const auto defaultDeviceId =
@@ -191,9 +418,9 @@ void AudioDeviceRecorder::openRecordingDevice() {
     return;
   }
 
-  _device = alcCaptureOpenDevice(
-      _deviceId.empty() ? nullptr : _deviceId.c_str(), kRecordingFrequency,
-      AL_FORMAT_MONO16, kRecordingFrequency);
+  _device = recorder::OpenCaptureDevice(_deviceId, _format);
+  _recordedFrames = 0;
+  _driftCompensator->Reset();
 
   if (!_device) {
     _recordingFailed = true;
@@ -0,0 +1,128 @@
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "audio_device_registry.h"
+
+namespace {
+
+// Prefix OpenAL Soft adds to the names of all its devices.
+const char kOpenALSoftPrefix[] = "OpenAL Soft on ";
+
+// Single audio device of a `DeviceList`.
+struct Device {
+  // Human-readable name of this device.
+  std::string name;
+
+  // Unique OpenAL identifier of this device.
+  std::string guid;
+};
+
+// Parsed list of the devices of a single OpenAL specifier.
+struct DeviceList {
+  // Devices in the order OpenAL enumerates them.
+  std::vector<Device> devices;
+
+  // Indices of the `devices` by their GUIDs.
+  std::unordered_map<std::string, size_t> indices;
+};
+
+// Mutex guarding all the fields below, and serializing the enumeration, as
+// OpenAL reuses the same storage for the enumerated lists.
+std::mutex registry_mutex;
+
+// Indicator whether the parsed lists are kept until `Invalidate()`.
+bool caching_enabled = false;
+
+// Cached lists of the playout and recording devices.
+std::shared_ptr<const DeviceList> playout_devices;
+std::shared_ptr<const DeviceList> recording_devices;
+
+// Parses the `alcGetString()` list of the provided `specifier`.
+std::shared_ptr<const DeviceList> Parse(ALCenum specifier) {
+  auto list = std::make_shared<DeviceList>();
+
+  auto devices = alcGetString(nullptr, specifier);
+  while (devices && *devices != 0) {
+    Device device;
+    device.guid = devices;
+    device.name = device.guid;
+    if (device.name.rfind(kOpenALSoftPrefix, 0) == 0) {
+      device.name = device.name.substr(sizeof(kOpenALSoftPrefix) - 1);
+    }
+    devices += device.guid.size() + 1;
+
+    list->indices.emplace(device.guid, list->devices.size());
+    list->devices.push_back(std::move(device));
+  }
+
+  return list;
+}
+
+// Returns the list of the provided `specifier`, parsing it if it's not cached.
+std::shared_ptr<const DeviceList> List(ALCenum specifier) {
+  std::lock_guard<std::mutex> lk(registry_mutex);
+
+  auto& cached = specifier == ALC_CAPTURE_DEVICE_SPECIFIER ? recording_devices
+                                                           : playout_devices;
+  if (cached && caching_enabled) {
+    return cached;
+  }
+  cached = Parse(specifier);
+  return cached;
+}
+
+}  // namespace
+
+// Enables caching of the parsed lists until `Invalidate()`.
+void AudioDeviceRegistry::EnableCaching() {
+  std::lock_guard<std::mutex> lk(registry_mutex);
+  caching_enabled = true;
+}
+
+// Disables caching of the parsed lists, dropping the cached ones.
+void AudioDeviceRegistry::DisableCaching() {
+  std::lock_guard<std::mutex> lk(registry_mutex);
+  caching_enabled = false;
+  playout_devices = nullptr;
+  recording_devices = nullptr;
+}
+
+// Drops the cached lists, so they're re-parsed on the next query.
+void AudioDeviceRegistry::Invalidate() {
+  std::lock_guard<std::mutex> lk(registry_mutex);
+  playout_devices = nullptr;
+  recording_devices = nullptr;
+}
+
+// Returns the number of devices of the provided OpenAL `specifier`.
+int AudioDeviceRegistry::Count(ALCenum specifier) {
+  return static_cast<int>(List(specifier)->devices.size());
+}
+
+// Writes the name and GUID of the device with the provided `index`.
+bool AudioDeviceRegistry::Get(ALCenum specifier,
+                              int index,
+                              std::string* name,
+                              std::string* guid) {
+  const auto list = List(specifier);
+  if (index < 0 || static_cast<size_t>(index) >= list->devices.size()) {
+    return false;
+  }
+
+  const auto& device = list->devices[index];
+  if (name) {
+    *name = device.name;
+  }
+  if (guid) {
+    *guid = device.guid;
+  }
+  return true;
+}
+
+// Indicates whether the device with the provided `guid` is present.
+bool AudioDeviceRegistry::Contains(ALCenum specifier, const std::string& guid) {
+  const auto list = List(specifier);
+  return list->indices.count(guid) != 0;
+}
@@ -2,9 +2,6 @@
 #include <memory>
 #include <string>
 
-#include <chrono>
-#include <thread>
-
 #include "api/video/i420_buffer.h"
 #include "api/video_codecs/video_decoder_factory_template.h"
 #include "api/video_codecs/video_decoder_factory_template_dav1d_adapter.h"
@@ -47,26 +44,24 @@ void TrackEventObserver::set_track(
   track_ = track;
 }
 
-// Creates a new fake `DeviceVideoCapturer` with the specified constraints and
-// calls `CreateVideoTrackSourceProxy()`.
+// Creates a new `FakeVideoSource` with the specified constraints and calls
+// `CreateVideoTrackSourceProxy()`.
 std::unique_ptr<VideoTrackSourceInterface> create_fake_device_video_source(
     Thread& worker_thread,
     Thread& signaling_thread,
     size_t width,
     size_t height,
-    size_t fps) {
-  auto src = webrtc::FakeVideoTrackSource::Create();
-
-  int fps_ms = 1000 / fps;
-  int timestamp_offset_us = 1000000 / fps;
-  auto th = std::thread([=] {
-    auto frame = cricket::FakeFrameSource(width, height, timestamp_offset_us);
-    while (true) {
-      src->InjectFrame(frame.GetFrame());
-      std::this_thread::sleep_for(std::chrono::milliseconds(fps_ms));
-    }
-  });
-  th.detach();
+    size_t fps,
+    FakeVideoContent content,
+    bool counter_overlay) {
+  auto frame_content = FakeFrameContent::kBlack;
+  if (content == FakeVideoContent::Gradient) {
+    frame_content = FakeFrameContent::kGradient;
+  } else if (content == FakeVideoContent::Noise) {
+    frame_content = FakeFrameContent::kNoise;
+  }
+  auto src = rtc::make_ref_counted<FakeVideoSource>(
+      width, height, fps, frame_content, counter_overlay);
 
   auto proxied = webrtc::CreateVideoTrackSourceProxy(&signaling_thread,
                                                      &worker_thread, src.get());
@@ -246,6 +241,47 @@ int32_t set_audio_playout_device(const AudioDeviceModule& audio_device_module,
   return audio_device_module->SetPlayoutDevice(index);
 }
 
+// Calls `ExtendedADM->SetPlayoutBufferDepth()`.
+int32_t set_playout_buffer_depth(const AudioDeviceModule& audio_device_module,
+                                 uint16_t buffers) {
+  return audio_device_module->SetPlayoutBufferDepth(buffers);
+}
+
+// Calls the provided `operation` via `ExtendedADM->CallAsync()`, passing its
+// result to the provided callback.
+template <typename Operation>
+void call_audio_device_module_async(
+    const AudioDeviceModule& audio_device_module,
+    Operation operation,
+    rust::Box<DynAudioDeviceModuleCallback> cb) {
+  audio_device_module->CallAsync(
+      [operation = std::move(operation),
+       cb = std::move(cb)](ExtendedADM& adm) mutable {
+        on_audio_device_module_call_done(std::move(cb), operation(adm));
+      });
+}
+
+// Calls `AudioDeviceModule->SetPlayoutDevice()` asynchronously.
+void set_audio_playout_device_async(
+    const AudioDeviceModule& audio_device_module,
+    uint16_t index,
+    rust::Box<DynAudioDeviceModuleCallback> cb) {
+  call_audio_device_module_async(
+      audio_device_module,
+      [index](ExtendedADM& adm) { return adm.SetPlayoutDevice(index); },
+      std::move(cb));
+}
+
+// Calls `AudioDeviceModule->SetMicrophoneVolume()` asynchronously.
+void set_microphone_volume_async(const AudioDeviceModule& audio_device_module,
+                                 uint32_t volume,
+                                 rust::Box<DynAudioDeviceModuleCallback> cb) {
+  call_audio_device_module_async(
+      audio_device_module,
+      [volume](ExtendedADM& adm) { return adm.SetMicrophoneVolume(volume); },
+      std::move(cb));
+}
+
 // Calls `AudioProcessingBuilder().Create()`.
 std::unique_ptr<AudioProcessing> create_audio_processing() {
   auto ap = webrtc::AudioProcessingBuilder().Create();
@@ -310,9 +346,11 @@ std::unique_ptr<VideoTrackSourceInterface> create_display_video_source(
     int64_t id,
     size_t width,
     size_t height,
-    size_t fps) {
+    size_t fps,
+    uint8_t cpu_budget_percentage) {
   rtc::scoped_refptr<ScreenVideoCapturer> capturer(
-      new rtc::RefCountedObject<ScreenVideoCapturer>(id, width, height, fps));
+      new rtc::RefCountedObject<ScreenVideoCapturer>(id, width, height, fps,
+                                                     cpu_budget_percentage));
 
   auto src = webrtc::CreateVideoTrackSourceProxy(
       &signaling_thread, &worker_thread, capturer.get());
@@ -324,11 +362,57 @@ std::unique_ptr<VideoTrackSourceInterface> create_display_video_source(
   return std::make_unique<VideoTrackSourceInterface>(src);
 }
 
+// Returns the counters of the `I420BufferPool`s of all the screen capturers and
+// fake video sources.
+I420BufferPoolStats i420_buffer_pool_stats() {
+  return I420BufferPoolStats{I420BufferPool::hits(), I420BufferPool::misses(),
+                             I420BufferPool::depth()};
+}
+
+// Sets the maximum number of `I420Buffer`s kept by every `I420BufferPool`.
+void set_i420_buffer_pool_depth(size_t depth) {
+  I420BufferPool::set_depth(depth);
+}
+
+// Enables caching of the enumerated audio devices until they're invalidated.
+void enable_audio_device_cache() {
+  AudioDeviceRegistry::EnableCaching();
+}
+
+// Disables caching of the enumerated audio devices, so they're re-enumerated on
+// every query.
+void disable_audio_device_cache() {
+  AudioDeviceRegistry::DisableCaching();
+}
+
+// Drops the cached audio devices, so they're re-enumerated on the next query.
+void invalidate_audio_device_cache() {
+  AudioDeviceRegistry::Invalidate();
+}
+
 // Creates a new `AudioSource` with the provided `AudioDeviceModule`.
 std::unique_ptr<AudioSourceInterface> create_audio_source(
     const AudioDeviceModule& audio_device_module,
-    uint16_t device_index) {
-  auto src = audio_device_module->CreateAudioSource(device_index);
+    uint16_t device_index,
+    AudioCaptureFormat format,
+    AudioProcessingOptions processing) {
+  RecordingFormat recording_format;
+  recording_format.sampleRate = static_cast<int>(format.sample_rate);
+  recording_format.channels = format.channels;
+  recording_format.sampleFormat =
+      format.sample_format == AudioSampleFormat::Float32
+          ? RecordingSampleFormat::kFloat32
+          : RecordingSampleFormat::kInt16;
+  recording_format.ringSizeMs = static_cast<int>(format.ring_size_ms);
+
+  cricket::AudioOptions options;
+  options.echo_cancellation = processing.echo_cancellation;
+  options.noise_suppression = processing.noise_suppression;
+  options.auto_gain_control = processing.auto_gain_control;
+  options.highpass_filter = processing.high_pass_filter;
+
+  auto src = audio_device_module->CreateAudioSource(
+      device_index, recording_format, options);
   if (src == nullptr) {
     return nullptr;
   }
@@ -342,10 +426,38 @@ void dispose_audio_source(const AudioDeviceModule& audio_device_module,
   audio_device_module->DisposeAudioSource(std::string(device_id));
 }
 
-// Creates a new fake `AudioSource`.
-std::unique_ptr<AudioSourceInterface> create_fake_audio_source() {
-  return std::make_unique<AudioSourceInterface>(
-      bridge::LocalAudioSource::Create(cricket::AudioOptions()));
+// Creates a new `SyntheticAudioSource` with the provided `FakeAudioOptions`.
+std::unique_ptr<AudioSourceInterface> create_fake_audio_source(
+    const FakeAudioOptions& options) {
+  SyntheticAudioOptions synthetic_options;
+  switch (options.signal) {
+    case FakeAudioSignal::Silence:
+      synthetic_options.signal = SyntheticSignal::kSilence;
+      break;
+    case FakeAudioSignal::Sine:
+      synthetic_options.signal = SyntheticSignal::kSine;
+      break;
+    case FakeAudioSignal::Sweep:
+      synthetic_options.signal = SyntheticSignal::kSweep;
+      break;
+    case FakeAudioSignal::Noise:
+      synthetic_options.signal = SyntheticSignal::kNoise;
+      break;
+    case FakeAudioSignal::WavFile:
+      synthetic_options.signal = SyntheticSignal::kWavFile;
+      break;
+  }
+  synthetic_options.frequencyHz = static_cast<int>(options.frequency_hz);
+  synthetic_options.wavPath = std::string(options.wav_path);
+  synthetic_options.markerIntervalMs =
+      static_cast<int>(options.marker_interval_ms);
+
+  auto source = SyntheticAudioSource::Create(std::move(synthetic_options));
+  if (source == nullptr) {
+    return nullptr;
+  }
+
+  return std::make_unique<AudioSourceInterface>(source);
 }
 
 // Calls `PeerConnectionFactoryInterface->CreateVideoTrack`.
@@ -440,8 +552,14 @@ TrackState audio_track_state(const AudioTrackInterface& track) {
 //
 // Used to connect the given `track` to the underlying video engine.
 void add_or_update_video_sink(const VideoTrackInterface& track,
-                              VideoSinkInterface& sink) {
-  track->AddOrUpdateSink(&sink, rtc::VideoSinkWants());
+                              VideoSinkInterface& sink,
+                              const VideoSinkWants& wants) {
+  rtc::VideoSinkWants sink_wants;
+  sink_wants.max_pixel_count = wants.max_pixel_count;
+  sink_wants.max_framerate_fps = wants.max_framerate_fps;
+  sink_wants.resolution_alignment = wants.resolution_alignment;
+
+  track->AddOrUpdateSink(&sink, sink_wants);
 }
 
 // Detaches the provided video `sink` from the given `track`.
@@ -456,16 +574,78 @@ std::unique_ptr<VideoSinkInterface> create_forwarding_video_sink(
   return std::make_unique<video_sink::ForwardingVideoSink>(std::move(cb));
 }
 
+namespace {
+
+// Pixel layouts `convert_video_frame()` is able to output.
+enum class RgbLayout { kABGR, kARGB };
+
+// Converts the provided `webrtc::VideoFrame` pixels to the specified `layout`
+// and writes the result to the provided `dst`, which rows are `dst_stride`
+// bytes apart.
+//
+// The pixels are scaled to `dst_width`x`dst_height` and, if `rotate` is set,
+// rotated according to the `webrtc::VideoFrame::rotation()`. Scaling happens
+// on the YUV planes before the conversion, so the conversion cost depends on
+// the destination size only.
+//
+// I420 and NV12 buffers are converted directly, without materializing an I420
+// copy. `libyuv` picks SIMD kernels (AVX2, SSSE3, NEON, etc.) suitable for the
+// running CPU by itself.
+void convert_video_frame(const webrtc::VideoFrame& frame,
+                         RgbLayout layout,
+                         int dst_width,
+                         int dst_height,
+                         int dst_stride,
+                         bool rotate,
+                         uint8_t* dst) {
+  if (dst_width <= 0 || dst_height <= 0) {
+    return;
+  }
+
+  rtc::scoped_refptr<webrtc::VideoFrameBuffer> buffer =
+      frame.video_frame_buffer();
+  webrtc::VideoRotation rotation =
+      rotate ? frame.rotation() : webrtc::kVideoRotation_0;
+
+  bool transposed = rotation == webrtc::kVideoRotation_90 ||
+                    rotation == webrtc::kVideoRotation_270;
+  int scaled_width = transposed ? dst_height : dst_width;
+  int scaled_height = transposed ? dst_width : dst_height;
+  if (buffer->width() != scaled_width || buffer->height() != scaled_height) {
+    buffer = buffer->Scale(scaled_width, scaled_height);
+  }
+
+  if (rotation == webrtc::kVideoRotation_0 &&
+      buffer->type() == webrtc::VideoFrameBuffer::Type::kNV12) {
+    const webrtc::NV12BufferInterface* nv12 = buffer->GetNV12();
+    auto nv12_to_rgb = layout == RgbLayout::kABGR ? libyuv::NV12ToABGR
+                                                  : libyuv::NV12ToARGB;
+    nv12_to_rgb(nv12->DataY(), nv12->StrideY(), nv12->DataUV(),
+                nv12->StrideUV(), dst, dst_stride, nv12->width(),
+                nv12->height());
+    return;
+  }
+
+  // No-op for I420 buffers.
+  rtc::scoped_refptr<webrtc::I420BufferInterface> i420 = buffer->ToI420();
+  if (rotation != webrtc::kVideoRotation_0) {
+    i420 = webrtc::I420Buffer::Rotate(*i420, rotation);
+  }
+
+  auto i420_to_rgb =
+      layout == RgbLayout::kABGR ? libyuv::I420ToABGR : libyuv::I420ToARGB;
+  i420_to_rgb(i420->DataY(), i420->StrideY(), i420->DataU(), i420->StrideU(),
+              i420->DataV(), i420->StrideV(), dst, dst_stride, i420->width(),
+              i420->height());
+}
+
+}  // namespace
+
 // Converts the provided `webrtc::VideoFrame` pixels to the ABGR scheme and
 // writes the result to the provided `dst_abgr`.
 void video_frame_to_abgr(const webrtc::VideoFrame& frame, uint8_t* dst_abgr) {
-  rtc::scoped_refptr<webrtc::I420BufferInterface> buffer(
-      frame.video_frame_buffer()->ToI420());
-
-  libyuv::I420ToABGR(buffer->DataY(), buffer->StrideY(), buffer->DataU(),
-                     buffer->StrideU(), buffer->DataV(), buffer->StrideV(),
-                     dst_abgr, buffer->width() * 4, buffer->width(),
-                     buffer->height());
+  convert_video_frame(frame, RgbLayout::kABGR, frame.width(), frame.height(),
+                      frame.width() * 4, false, dst_abgr);
 }
 
 // Converts the provided `webrtc::VideoFrame` pixels to the ARGB scheme and
@@ -473,33 +653,114 @@ void video_frame_to_abgr(const webrtc::VideoFrame& frame, uint8_t* dst_abgr) {
 void video_frame_to_argb(const webrtc::VideoFrame& frame,
                          int argb_stride,
                          uint8_t* dst_argb) {
-  rtc::scoped_refptr<webrtc::I420BufferInterface> buffer(
-      frame.video_frame_buffer()->ToI420());
+  convert_video_frame(frame, RgbLayout::kARGB, frame.width(), frame.height(),
+                      argb_stride, false, dst_argb);
+}
+
+// Converts the provided `webrtc::VideoFrame` pixels to the ABGR scheme, scaled
+// to `dst_width`x`dst_height` and rotated if `apply_rotation` is set, and
+// writes the result to the provided `dst_abgr` with the `dst_stride`.
+void video_frame_to_abgr_scaled(const webrtc::VideoFrame& frame,
+                                int dst_width,
+                                int dst_height,
+                                int dst_stride,
+                                bool apply_rotation,
+                                uint8_t* dst_abgr) {
+  convert_video_frame(frame, RgbLayout::kABGR, dst_width, dst_height,
+                      dst_stride, apply_rotation, dst_abgr);
+}
+
+// Creates a new `webrtc::VideoFrame` sharing the pixel buffer of the provided
+// `frame`.
+std::unique_ptr<webrtc::VideoFrame> clone_video_frame(
+    const webrtc::VideoFrame& frame) {
+  return std::make_unique<webrtc::VideoFrame>(frame);
+}
 
-  libyuv::I420ToARGB(buffer->DataY(), buffer->StrideY(), buffer->DataU(),
-                     buffer->StrideU(), buffer->DataV(), buffer->StrideV(),
-                     dst_argb, argb_stride, buffer->width(), buffer->height());
+// Makes the provided `dst` frame share the pixel buffer and metadata of the
+// provided `src` frame, reusing the `dst` allocation.
+void assign_video_frame(webrtc::VideoFrame& dst,
+                        const webrtc::VideoFrame& src) {
+  dst = src;
 }
 
-// Creates a new `PeerConnectionFactoryInterface`.
+// Releases the pixel buffer referenced by the provided `frame`, so it can be
+// reused by its producer while the `frame` allocation itself is kept.
+void release_video_frame_buffer(webrtc::VideoFrame& frame) {
+  // `webrtc::VideoFrame` cannot hold a null buffer, so a tiny shared
+  // placeholder is used instead.
+  static const rtc::scoped_refptr<webrtc::VideoFrameBuffer> placeholder =
+      webrtc::I420Buffer::Create(2, 2);
+
+  frame.set_video_frame_buffer(placeholder);
+}
+
+// Creates a new `PeerConnectionFactoryInterface` with the provided
+// `VideoCodecConfig`.
 std::unique_ptr<PeerConnectionFactoryInterface> create_peer_connection_factory(
     const std::unique_ptr<Thread>& network_thread,
     const std::unique_ptr<Thread>& worker_thread,
     const std::unique_ptr<Thread>& signaling_thread,
     const std::unique_ptr<AudioDeviceModule>& default_adm,
-    const std::unique_ptr<AudioProcessing>& ap) {
+    const std::unique_ptr<AudioProcessing>& ap,
+    const VideoCodecConfig& video_codecs) {
+  VideoCodecPreferences preferences;
+  preferences.vp9_svc = video_codecs.vp9_svc;
+  preferences.codecs.reserve(video_codecs.codecs.size());
+  for (const auto& codec : video_codecs.codecs) {
+    VideoCodecPreference preference;
+    switch (codec.kind) {
+      case VideoCodecKind::VP8:
+        preference.type = webrtc::kVideoCodecVP8;
+        break;
+      case VideoCodecKind::VP9:
+        preference.type = webrtc::kVideoCodecVP9;
+        break;
+      case VideoCodecKind::H264:
+        preference.type = webrtc::kVideoCodecH264;
+        break;
+      case VideoCodecKind::AV1:
+        preference.type = webrtc::kVideoCodecAV1;
+        break;
+    }
+    switch (codec.complexity) {
+      case VideoEncoderComplexity::Low:
+        preference.complexity = webrtc::VideoCodecComplexity::kComplexityLow;
+        break;
+      case VideoEncoderComplexity::Normal:
+        preference.complexity =
+            webrtc::VideoCodecComplexity::kComplexityNormal;
+        break;
+      case VideoEncoderComplexity::High:
+        preference.complexity = webrtc::VideoCodecComplexity::kComplexityHigh;
+        break;
+      case VideoEncoderComplexity::Higher:
+        preference.complexity =
+            webrtc::VideoCodecComplexity::kComplexityHigher;
+        break;
+      case VideoEncoderComplexity::Max:
+        preference.complexity = webrtc::VideoCodecComplexity::kComplexityMax;
+        break;
+    }
+    preferences.codecs.push_back(preference);
+  }
+
   std::unique_ptr<webrtc::VideoEncoderFactory> video_encoder_factory =
-      std::make_unique<webrtc::VideoEncoderFactoryTemplate<
-          webrtc::LibvpxVp8EncoderTemplateAdapter,
-          webrtc::LibvpxVp9EncoderTemplateAdapter,
-          webrtc::OpenH264EncoderTemplateAdapter,
-          webrtc::LibaomAv1EncoderTemplateAdapter>>();
+      std::make_unique<PreferredVideoEncoderFactory>(
+          std::make_unique<webrtc::VideoEncoderFactoryTemplate<
+              webrtc::LibvpxVp8EncoderTemplateAdapter,
+              webrtc::LibvpxVp9EncoderTemplateAdapter,
+              webrtc::OpenH264EncoderTemplateAdapter,
+              webrtc::LibaomAv1EncoderTemplateAdapter>>(),
+          preferences);
   std::unique_ptr<webrtc::VideoDecoderFactory> video_decoder_factory =
-      std::make_unique<webrtc::VideoDecoderFactoryTemplate<
-          webrtc::LibvpxVp8DecoderTemplateAdapter,
-          webrtc::LibvpxVp9DecoderTemplateAdapter,
-          webrtc::OpenH264DecoderTemplateAdapter,
-          webrtc::Dav1dDecoderTemplateAdapter>>();
+      std::make_unique<PreferredVideoDecoderFactory>(
+          std::make_unique<webrtc::VideoDecoderFactoryTemplate<
+              webrtc::LibvpxVp8DecoderTemplateAdapter,
+              webrtc::LibvpxVp9DecoderTemplateAdapter,
+              webrtc::OpenH264DecoderTemplateAdapter,
+              webrtc::Dav1dDecoderTemplateAdapter>>(),
+          std::move(preferences));
 
   auto factory = webrtc::CreatePeerConnectionFactory(
       network_thread.get(), worker_thread.get(), signaling_thread.get(),
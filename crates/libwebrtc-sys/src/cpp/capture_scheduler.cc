@@ -0,0 +1,66 @@
+#include <algorithm>
+
+#include "capture_scheduler.h"
+#include "rtc_base/time_utils.h"
+
+namespace {
+
+// Weight of the last capture in the `average_cost_us_`, as a shift of `1`.
+//
+// An `8` captures window smooths out single hiccups while still reacting to a
+// sustained cost change within a fraction of a second.
+const int kCostWeightShift = 3;
+
+// Returns the interval between captures of the provided framerate.
+int64_t FramerateInterval(int fps) {
+  return rtc::kNumMicrosecsPerSec / std::max(fps, 1);
+}
+
+}  // namespace
+
+// Creates a new `CaptureScheduler` targeting the provided framerate and
+// spending at most `cpu_budget_percentage` of a CPU core on captures.
+CaptureScheduler::CaptureScheduler(int target_fps, int cpu_budget_percentage)
+    : target_interval_us_(FramerateInterval(target_fps)),
+      cpu_budget_percentage_(std::clamp(cpu_budget_percentage, 1, 100)) {}
+
+// Returns the monotonic time of the next capture in microseconds.
+//
+// Deadlines advance by whole intervals from the previous ones. If the capturer
+// has fallen behind by more than an interval, the missed captures are skipped
+// instead of being performed in a burst.
+int64_t CaptureScheduler::NextCaptureTimeUs(int64_t now_us) {
+  int64_t interval = interval_us();
+  if (next_capture_us_ == 0) {
+    next_capture_us_ = now_us;
+  } else {
+    next_capture_us_ += interval;
+    if (next_capture_us_ + interval < now_us) {
+      next_capture_us_ = now_us;
+    }
+  }
+  return next_capture_us_;
+}
+
+// Records the cost of the capture started at the last returned deadline.
+void CaptureScheduler::OnCaptureDone(int64_t cost_us) {
+  if (average_cost_us_ == 0) {
+    average_cost_us_ = cost_us;
+  } else {
+    average_cost_us_ += (cost_us - average_cost_us_) >> kCostWeightShift;
+  }
+}
+
+// Sets the maximum framerate requested by the sinks of the captured frames.
+void CaptureScheduler::SetMaxFramerate(int max_fps) {
+  sink_interval_us_ = max_fps > 0 ? FramerateInterval(max_fps) : 0;
+}
+
+// Returns the current capture interval in microseconds.
+//
+// It's the longest of the target interval, the one requested by the sinks and
+// the one keeping the average capture cost within the CPU budget.
+int64_t CaptureScheduler::interval_us() const {
+  int64_t budget_interval_us = average_cost_us_ * 100 / cpu_budget_percentage_;
+  return std::max({target_interval_us_, sink_interval_us_, budget_interval_us});
+}
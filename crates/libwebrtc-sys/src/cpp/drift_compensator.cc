@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <cmath>
+
+#include "drift_compensator.h"
+#include "rtc_base/time_utils.h"
+
+namespace {
+
+// Duration of the audio in a single frame, in milliseconds.
+const int64_t kFrameMs = 10;
+
+// Time since the start of the clock tracking ignored by the measurement, as
+// devices tend to deliver a burst of samples right after being started.
+const int64_t kClockWarmupUs = rtc::kNumMicrosecsPerSec;
+
+// Minimal time the clock is measured for before the measurement is applied.
+//
+// Devices deliver samples in periods of a few milliseconds, so the measurement
+// is only precise enough to be trusted over multiple seconds.
+const int64_t kMinClockMeasurementUs = 10 * rtc::kNumMicrosecsPerSec;
+
+// Number of frames buffered before a `Pop()` when the clocks are in sync.
+const double kTargetBufferedFrames = 2.0;
+
+// Correction of the step per each frame the buffer deviates from the
+// `kTargetBufferedFrames`, compensating the residual drift.
+const double kFillCorrectionRatio = 0.0005;
+
+// Weight of the last buffer fill in the `average_fill_`.
+const double kFillWeight = 1.0 / 16;
+
+}  // namespace
+
+// Creates a new `DriftCompensator` of the audio recorded from a device with
+// the provided nominal sample rate, producing 10 ms frames of the provided
+// number of samples per channel.
+DriftCompensator::DriftCompensator(int device_sample_rate,
+                                   size_t frame_samples,
+                                   size_t channels)
+    : device_sample_rate_(device_sample_rate),
+      frame_samples_(frame_samples),
+      channels_(channels) {
+  buffer_.reserve((kMaxDriftBufferedFrames + 1) * frame_samples_ * channels_);
+  Reset();
+}
+
+// Restarts the device clock tracking and drops all the buffered samples.
+void DriftCompensator::Reset() {
+  start_us_ = 0;
+  anchor_us_ = 0;
+  anchor_samples_ = 0;
+  clock_ratio_ = 1.0;
+  average_fill_ = kTargetBufferedFrames * frame_samples_;
+  buffer_.clear();
+  position_ = 0;
+}
+
+// Records that the device has produced `device_samples` per channel in total
+// by the monotonic time `now_us`.
+//
+// The clock ratio is measured over the whole time since the anchor, so its
+// precision keeps improving while the device is being recorded.
+void DriftCompensator::UpdateClock(int64_t now_us, int64_t device_samples) {
+  if (start_us_ == 0) {
+    start_us_ = now_us;
+    return;
+  }
+  if (anchor_us_ == 0) {
+    if (now_us - start_us_ >= kClockWarmupUs) {
+      anchor_us_ = now_us;
+      anchor_samples_ = device_samples;
+    }
+    return;
+  }
+
+  const auto elapsed_us = now_us - anchor_us_;
+  if (elapsed_us < kMinClockMeasurementUs) {
+    return;
+  }
+
+  const auto expected = static_cast<double>(elapsed_us) * device_sample_rate_ /
+                        rtc::kNumMicrosecsPerSec;
+  clock_ratio_ = std::clamp((device_samples - anchor_samples_) / expected,
+                            1.0 - kMaxClockDriftRatio,
+                            1.0 + kMaxClockDriftRatio);
+}
+
+// Appends the provided interleaved samples to the buffered ones.
+void DriftCompensator::Push(const int16_t* samples,
+                            size_t samples_per_channel) {
+  buffer_.insert(buffer_.end(), samples,
+                 samples + samples_per_channel * channels_);
+
+  const auto limit = kMaxDriftBufferedFrames * frame_samples_;
+  const auto buffered = buffered_samples();
+  if (buffered > limit) {
+    buffer_.erase(buffer_.begin(),
+                  buffer_.begin() + (buffered - limit) * channels_);
+    position_ = 0;
+  }
+}
+
+// Writes the next 10 ms frame of the compensated audio into the provided
+// `frame`, if enough samples are buffered.
+bool DriftCompensator::Pop(int16_t* frame) {
+  const auto step = Step();
+  const auto last = position_ + step * (frame_samples_ - 1);
+  const auto buffered = buffered_samples();
+  if (static_cast<size_t>(last) + 1 >= buffered) {
+    return false;
+  }
+  average_fill_ += (buffered - average_fill_) * kFillWeight;
+
+  for (size_t i = 0; i < frame_samples_; ++i) {
+    const auto x = position_ + step * i;
+    const auto index = static_cast<size_t>(x);
+    const auto fraction = x - index;
+    const auto* a = &buffer_[index * channels_];
+    const auto* b = a + channels_;
+    for (size_t c = 0; c < channels_; ++c) {
+      frame[i * channels_ + c] =
+          static_cast<int16_t>(std::lrint(a[c] + (b[c] - a[c]) * fraction));
+    }
+  }
+
+  position_ += step * frame_samples_;
+  const auto consumed = static_cast<size_t>(position_);
+  buffer_.erase(buffer_.begin(), buffer_.begin() + consumed * channels_);
+  position_ -= consumed;
+
+  return true;
+}
+
+// Returns the duration of the buffered samples in milliseconds.
+int64_t DriftCompensator::buffered_ms() const {
+  return static_cast<int64_t>(buffered_samples()) * kFrameMs /
+         static_cast<int64_t>(frame_samples_);
+}
+
+// Returns the number of the buffered samples per channel.
+size_t DriftCompensator::buffered_samples() const {
+  return buffer_.size() / channels_;
+}
+
+// Returns the number of the buffered samples per channel consumed per one
+// produced sample.
+//
+// A device running fast produces more samples than the nominal rate, so more
+// of them are consumed per produced one, and vice versa. The measured clock
+// ratio is corrected by the deviation of the buffer fill from the target one,
+// so an imprecise measurement never makes the buffer run dry or overflow.
+double DriftCompensator::Step() const {
+  const auto deviation =
+      average_fill_ / frame_samples_ - kTargetBufferedFrames;
+  return std::clamp(clock_ratio_ * (1.0 + deviation * kFillCorrectionRatio),
+                    1.0 - kMaxClockDriftRatio, 1.0 + kMaxClockDriftRatio);
+}
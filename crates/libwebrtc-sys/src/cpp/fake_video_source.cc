@@ -0,0 +1,323 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "fake_video_source.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/time_utils.h"
+
+namespace {
+
+// Luma of the `0` and `1` cells of the counter overlay.
+const uint8_t kCounterZeroLuma = 16;
+const uint8_t kCounterOneLuma = 235;
+
+// Neutral chroma, making pixels gray.
+const uint8_t kNeutralChroma = 128;
+
+// Single thread producing the frames of all the `FakeVideoSource`s at their
+// deadlines.
+class FakeVideoPacer {
+ public:
+  // Returns the process-wide `FakeVideoPacer`.
+  //
+  // It's never destroyed, as its thread idles while there are no sources.
+  static FakeVideoPacer& Instance() {
+    static auto* pacer = new FakeVideoPacer();
+    return *pacer;
+  }
+
+  // Starts producing frames of the provided `source`, returning its ID.
+  uint64_t Register(FakeVideoSource* source) {
+    uint64_t id;
+    {
+      std::lock_guard<std::mutex> lk(mutex_);
+      id = next_id_++;
+      sources_.emplace(id, source);
+      deadlines_.push(Deadline{rtc::TimeMicros(), id});
+    }
+    wakeup_.notify_one();
+    return id;
+  }
+
+  // Stops producing frames of the source with the provided ID.
+  //
+  // Once this returns, the source is guaranteed not to be used anymore.
+  void Unregister(uint64_t id) {
+    std::unique_lock<std::mutex> lk(mutex_);
+    sources_.erase(id);
+    produced_.wait(lk, [&] { return producing_ != id; });
+  }
+
+ private:
+  // Deadline of the next frame of a single source.
+  struct Deadline {
+    // Monotonic time of the frame in microseconds.
+    int64_t time_us;
+
+    // ID of the source to produce the frame of.
+    uint64_t id;
+
+    bool operator>(const Deadline& other) const {
+      return time_us > other.time_us;
+    }
+  };
+
+  FakeVideoPacer() {
+    rtc::PlatformThread::SpawnDetached([this] { Run(); }, "fake_video_pacer");
+  }
+
+  // Produces the frames of the registered sources at their deadlines.
+  void Run() {
+    std::unique_lock<std::mutex> lk(mutex_);
+    while (true) {
+      wakeup_.wait(lk, [this] { return !deadlines_.empty(); });
+
+      const auto next = deadlines_.top();
+      const auto it = sources_.find(next.id);
+      if (it == sources_.end()) {
+        // The source has been unregistered.
+        deadlines_.pop();
+        continue;
+      }
+
+      const auto now_us = rtc::TimeMicros();
+      if (next.time_us > now_us) {
+        // Woken up either by the deadline or by a new source, which may have
+        // an earlier one.
+        wakeup_.wait_for(lk, std::chrono::microseconds(next.time_us - now_us));
+        continue;
+      }
+      deadlines_.pop();
+
+      auto* source = it->second;
+      producing_ = next.id;
+      lk.unlock();
+      source->ProduceFrame(next.time_us);
+      lk.lock();
+      producing_ = 0;
+      produced_.notify_all();
+
+      if (sources_.count(next.id) == 0) {
+        continue;
+      }
+
+      // Deadlines are kept on the grid of the first one, so the time spent on
+      // producing frames doesn't accumulate. The missed ones (e.g. after the
+      // process has been suspended) are skipped rather than produced in a
+      // burst.
+      const auto interval_us = source->interval_us();
+      auto deadline = next.time_us + interval_us;
+      const auto after_us = rtc::TimeMicros();
+      if (deadline <= after_us) {
+        deadline += ((after_us - deadline) / interval_us + 1) * interval_us;
+      }
+      deadlines_.push(Deadline{deadline, next.id});
+    }
+  }
+
+  // Mutex guarding all the fields below.
+  std::mutex mutex_;
+
+  // Condition variable waking up the pacing thread.
+  std::condition_variable wakeup_;
+
+  // Condition variable notified once a frame has been produced.
+  std::condition_variable produced_;
+
+  // Registered sources by their IDs.
+  std::unordered_map<uint64_t, FakeVideoSource*> sources_;
+
+  // Deadlines of the next frames, the earliest first.
+  std::priority_queue<Deadline, std::vector<Deadline>, std::greater<Deadline>>
+      deadlines_;
+
+  // ID of the next registered source.
+  uint64_t next_id_ = 1;
+
+  // ID of the source a frame is being produced of, or `0` if none.
+  uint64_t producing_ = 0;
+};
+
+// Fills the provided rectangle of the `buffer` with a gray of the provided
+// `luma`.
+void FillGray(webrtc::I420Buffer* buffer,
+              int x,
+              int y,
+              int width,
+              int height,
+              uint8_t luma) {
+  for (int row = y; row < y + height; ++row) {
+    std::memset(buffer->MutableDataY() + row * buffer->StrideY() + x, luma,
+                width);
+  }
+
+  const auto chroma_x = x / 2;
+  const auto chroma_width = (x + width + 1) / 2 - chroma_x;
+  for (int row = y / 2; row < (y + height + 1) / 2; ++row) {
+    std::memset(buffer->MutableDataU() + row * buffer->StrideU() + chroma_x,
+                kNeutralChroma, chroma_width);
+    std::memset(buffer->MutableDataV() + row * buffer->StrideV() + chroma_x,
+                kNeutralChroma, chroma_width);
+  }
+}
+
+}  // namespace
+
+// Creates a new `FakeVideoSource` and starts producing its frames.
+FakeVideoSource::FakeVideoSource(int width,
+                                 int height,
+                                 int fps,
+                                 FakeFrameContent content,
+                                 bool counter_overlay)
+    : width_(width),
+      height_(height),
+      interval_us_(rtc::kNumMicrosecsPerSec / (std::max)(fps, 1)),
+      content_(content),
+      counter_overlay_(counter_overlay) {
+  pacer_id_ = FakeVideoPacer::Instance().Register(this);
+}
+
+// Stops producing frames, waiting for the one being produced, if any.
+FakeVideoSource::~FakeVideoSource() {
+  FakeVideoPacer::Instance().Unregister(pacer_id_);
+}
+
+// Produces a new frame captured at the provided monotonic time.
+void FakeVideoSource::ProduceFrame(int64_t capture_time_us) {
+  int adapted_width;
+  int adapted_height;
+  int crop_width;
+  int crop_height;
+  int crop_x;
+  int crop_y;
+  const auto adapted =
+      AdaptFrame(width_, height_, capture_time_us, &adapted_width,
+                 &adapted_height, &crop_width, &crop_height, &crop_x, &crop_y);
+  if (adapted) {
+    // Content is synthetic, so it's drawn in the adapted size right away
+    // instead of being scaled.
+    auto buffer = buffer_pool_.Acquire(adapted_width, adapted_height);
+    DrawContent(buffer.get());
+    if (counter_overlay_) {
+      DrawCounter(buffer.get(), capture_time_us);
+    }
+
+    OnFrame(webrtc::VideoFrame::Builder()
+                .set_video_frame_buffer(buffer)
+                .set_rotation(webrtc::kVideoRotation_0)
+                .set_timestamp_us(capture_time_us)
+                .build());
+  }
+
+  ++frame_number_;
+}
+
+// Returns the interval between the produced frames in microseconds.
+int64_t FakeVideoSource::interval_us() const {
+  return interval_us_;
+}
+
+// Fills the provided `buffer` with the `content_` of the current frame.
+void FakeVideoSource::DrawContent(webrtc::I420Buffer* buffer) {
+  const auto width = buffer->width();
+  const auto height = buffer->height();
+  const auto chroma_width = buffer->ChromaWidth();
+  const auto chroma_height = buffer->ChromaHeight();
+
+  switch (content_) {
+    case FakeFrameContent::kBlack:
+      // Pooled buffers are black initially, and only the counter overlay is
+      // ever drawn over them, at the same place.
+      break;
+
+    case FakeFrameContent::kGradient: {
+      const auto shift = static_cast<int>(frame_number_ * 2);
+      for (int y = 0; y < height; ++y) {
+        auto* row = buffer->MutableDataY() + y * buffer->StrideY();
+        for (int x = 0; x < width; ++x) {
+          row[x] = static_cast<uint8_t>(x + y + shift);
+        }
+      }
+      for (int y = 0; y < chroma_height; ++y) {
+        auto* u = buffer->MutableDataU() + y * buffer->StrideU();
+        auto* v = buffer->MutableDataV() + y * buffer->StrideV();
+        for (int x = 0; x < chroma_width; ++x) {
+          u[x] = static_cast<uint8_t>(x * 2 + shift);
+          v[x] = static_cast<uint8_t>(y * 2 - shift);
+        }
+      }
+      break;
+    }
+
+    case FakeFrameContent::kNoise: {
+      // `xorshift64*` generator, seeded by the frame number.
+      auto state = (frame_number_ + 1) * 0x9E3779B97F4A7C15ULL;
+      auto next = [&state] {
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1DULL;
+      };
+      for (int y = 0; y < height; ++y) {
+        auto* row = buffer->MutableDataY() + y * buffer->StrideY();
+        for (int x = 0; x < width; x += 8) {
+          const auto random = next();
+          const auto count = (std::min)(8, width - x);
+          std::memcpy(row + x, &random, count);
+        }
+      }
+      for (int y = 0; y < chroma_height; ++y) {
+        std::memset(buffer->MutableDataU() + y * buffer->StrideU(),
+                    kNeutralChroma, chroma_width);
+        std::memset(buffer->MutableDataV() + y * buffer->StrideV(),
+                    kNeutralChroma, chroma_width);
+      }
+      break;
+    }
+  }
+}
+
+// Draws the frame number and the capture time rows of the counter overlay.
+void FakeVideoSource::DrawCounter(webrtc::I420Buffer* buffer,
+                                  int64_t capture_time_us) {
+  const auto cell = buffer->width() / kCounterOverlayBits;
+  if (cell == 0 || cell * 2 > buffer->height()) {
+    return;
+  }
+
+  const uint64_t rows[] = {frame_number_,
+                           static_cast<uint64_t>(capture_time_us)};
+  for (int row = 0; row < 2; ++row) {
+    for (int bit = 0; bit < kCounterOverlayBits; ++bit) {
+      const auto one = (rows[row] >> (kCounterOverlayBits - 1 - bit)) & 1;
+      FillGray(buffer, bit * cell, row * cell, cell, cell,
+               one ? kCounterOneLuma : kCounterZeroLuma);
+    }
+  }
+}
+
+// Indicates that parameters suitable for screencast should not be applied.
+bool FakeVideoSource::is_screencast() const {
+  return false;
+}
+
+// Leaves the denoising to the default configuration of the encoder.
+absl::optional<bool> FakeVideoSource::needs_denoising() const {
+  return absl::nullopt;
+}
+
+// Returns the state of this `FakeVideoSource`, which is always live.
+webrtc::MediaSourceInterface::SourceState FakeVideoSource::state() const {
+  return SourceState::kLive;
+}
+
+// Always returns `false` since `FakeVideoSource` produces frames locally.
+bool FakeVideoSource::remote() const {
+  return false;
+}
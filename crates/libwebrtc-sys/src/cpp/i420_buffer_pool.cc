@@ -0,0 +1,95 @@
+#include <algorithm>
+
+#include "i420_buffer_pool.h"
+#include "rtc_base/ref_counted_object.h"
+
+namespace {
+
+// Maximum number of buffers kept by every `I420BufferPool`.
+std::atomic<size_t> pool_depth(kDefaultI420BufferPoolDepth);
+
+// Total number of buffers reused by all the `I420BufferPool`s.
+std::atomic<uint64_t> pool_hits(0);
+
+// Total number of buffers allocated by all the `I420BufferPool`s.
+std::atomic<uint64_t> pool_misses(0);
+
+// Indicates whether the provided `buffer` isn't referenced by anyone else.
+bool HasOneRef(const rtc::scoped_refptr<webrtc::I420Buffer>& buffer) {
+  // `I420Buffer::Create()` always produces a `RefCountedObject`.
+  return static_cast<rtc::RefCountedObject<webrtc::I420Buffer>*>(buffer.get())
+      ->HasOneRef();
+}
+
+}  // namespace
+
+// Returns an `I420Buffer` of the provided size not referenced by anyone else.
+rtc::scoped_refptr<webrtc::I420Buffer> I420BufferPool::Acquire(int width,
+                                                               int height) {
+  size_t depth = pool_depth.load(std::memory_order_relaxed);
+
+  // Buffers of other sizes won't ever be reused, as producers change their
+  // resolution rarely.
+  auto stale = [&](const rtc::scoped_refptr<webrtc::I420Buffer>& buffer) {
+    return buffer->width() != width || buffer->height() != height;
+  };
+  buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(), stale),
+                 buffers_.end());
+
+  for (auto it = buffers_.begin(); it != buffers_.end(); ++it) {
+    if (HasOneRef(*it)) {
+      rtc::scoped_refptr<webrtc::I420Buffer> buffer = *it;
+      if (buffers_.size() > depth) {
+        buffers_.erase(it);
+      }
+      pool_hits.fetch_add(1, std::memory_order_relaxed);
+      return buffer;
+    }
+  }
+
+  rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      webrtc::I420Buffer::Create(width, height);
+  buffer->InitializeData();
+  if (buffers_.size() < depth) {
+    buffers_.push_back(buffer);
+  }
+  pool_misses.fetch_add(1, std::memory_order_relaxed);
+  return buffer;
+}
+
+// Indicates whether the provided `buffer` is referenced by nobody but this
+// pool and the caller.
+bool I420BufferPool::IsExclusive(
+    const rtc::scoped_refptr<webrtc::I420Buffer>& buffer) {
+  auto it = std::find(buffers_.begin(), buffers_.end(), buffer);
+  if (it == buffers_.end()) {
+    return HasOneRef(buffer);
+  }
+
+  // The pool's reference is dropped for the check, while the caller's one
+  // keeps the `buffer` alive.
+  *it = nullptr;
+  bool exclusive = HasOneRef(buffer);
+  *it = buffer;
+  return exclusive;
+}
+
+// Returns the maximum number of buffers kept by every `I420BufferPool`.
+size_t I420BufferPool::depth() {
+  return pool_depth.load(std::memory_order_relaxed);
+}
+
+// Sets the maximum number of buffers kept by every `I420BufferPool`.
+void I420BufferPool::set_depth(size_t depth) {
+  pool_depth.store(depth, std::memory_order_relaxed);
+}
+
+// Returns the total number of buffers reused by all the `I420BufferPool`s.
+uint64_t I420BufferPool::hits() {
+  return pool_hits.load(std::memory_order_relaxed);
+}
+
+// Returns the total number of buffers allocated by all the `I420BufferPool`s.
+uint64_t I420BufferPool::misses() {
+  return pool_misses.load(std::memory_order_relaxed);
+}
@@ -1,7 +1,17 @@
+#include <algorithm>
+#include <thread>
+
 #include "local_audio_source.h"
 
 namespace bridge {
 
+namespace {
+
+// `LocalAudioSource` propagating audio data on the current thread, if any.
+thread_local const LocalAudioSource* dispatching_source = nullptr;
+
+}  // namespace
+
 rtc::scoped_refptr<LocalAudioSource> LocalAudioSource::Create(
     cricket::AudioOptions audio_options) {
   auto source = rtc::make_ref_counted<LocalAudioSource>();
@@ -9,29 +19,69 @@ rtc::scoped_refptr<LocalAudioSource> LocalAudioSource::Create(
   return source;
 }
 
+LocalAudioSource::LocalAudioSource() : sinks_(new SinkList()) {}
+
+LocalAudioSource::~LocalAudioSource() {
+  delete sinks_.load();
+}
+
 void LocalAudioSource::AddSink(webrtc::AudioTrackSinkInterface* sink) {
-  std::lock_guard<std::recursive_mutex> lk(sink_lock_);
+  std::lock_guard<std::mutex> lk(sinks_mutex_);
 
-  sinks_.push_back(sink);
+  auto sinks = std::make_unique<SinkList>(*sinks_.load());
+  sinks->push_back(sink);
+  PublishSinks(std::move(sinks));
 }
 
 void LocalAudioSource::RemoveSink(webrtc::AudioTrackSinkInterface* sink) {
-  std::lock_guard<std::recursive_mutex> lk(sink_lock_);
+  std::lock_guard<std::mutex> lk(sinks_mutex_);
 
-  sinks_.remove(sink);
+  auto sinks = std::make_unique<SinkList>(*sinks_.load());
+  sinks->erase(std::remove(sinks->begin(), sinks->end(), sink), sinks->end());
+  PublishSinks(std::move(sinks));
+}
+
+// Replaces the `sinks_` with the provided ones.
+//
+// An `OnData()` call loads the `sinks_` only after announcing itself in the
+// `dispatching_`, so once there are no calls in progress, none of them can use
+// the previous list anymore. The calls take microseconds, so spinning is
+// cheaper than blocking the audio thread on a lock.
+void LocalAudioSource::PublishSinks(std::unique_ptr<SinkList> sinks) {
+  std::unique_ptr<const SinkList> previous(sinks_.exchange(sinks.release()));
+
+  // The `OnData()` call on this thread can't complete before this returns,
+  // so the list it iterates is freed on the next change instead.
+  const auto reentrant = dispatching_source == this;
+  while (dispatching_.load() > (reentrant ? 1 : 0)) {
+    std::this_thread::yield();
+  }
+
+  if (reentrant) {
+    retired_sinks_.push_back(std::move(previous));
+  } else {
+    retired_sinks_.clear();
+  }
 }
 
 void LocalAudioSource::OnData(const void* audio_data,
                               int bits_per_sample,
                               int sample_rate,
                               size_t number_of_channels,
-                              size_t number_of_frames) {
-  std::lock_guard<std::recursive_mutex> lk(sink_lock_);
+                              size_t number_of_frames,
+                              absl::optional<int64_t>
+                                  absolute_capture_timestamp_ms) {
+  dispatching_.fetch_add(1);
+  const auto* previous_source = dispatching_source;
+  dispatching_source = this;
 
-  for (auto* sink : sinks_) {
+  for (auto* sink : *sinks_.load()) {
     sink->OnData(audio_data, bits_per_sample, sample_rate, number_of_channels,
-                 number_of_frames);
+                 number_of_frames, absolute_capture_timestamp_ms);
   }
+
+  dispatching_source = previous_source;
+  dispatching_.fetch_sub(1);
 }
 
 }  // namespace bridge
@@ -1,4 +1,7 @@
+#include <unordered_set>
+
 #include "libwebrtc-sys/src/bridge.rs.h"
+#include "rtc_base/time_utils.h"
 
 namespace bridge {
 
@@ -184,6 +187,43 @@ void RTCStatsCollectorCallback::OnStatsDelivered(const RTCStatsReport& report) {
   }
 }
 
+// `RTCStatsCollectorCallback` merging the stats of the `RTCStatsType`s in the
+// provided `type_mask` of the reports of the provided number of `GetStats()`
+// calls.
+MergingStatsCollectorCallback::MergingStatsCollectorCallback(
+    size_t expected,
+    uint32_t type_mask,
+    rust::Box<bridge::DynRTCStatsCollectorCallback> cb)
+    : pending_(expected), type_mask_(type_mask), cb_(std::move(cb)) {};
+
+// Merges the provided report, propagating the merged one to the Rust side once
+// all the reports are delivered.
+//
+// Stats of the types not in the `type_mask_` are skipped, and reports of
+// different selectors share some stats (e.g. transports), so only the selected
+// ones not merged yet are copied.
+void MergingStatsCollectorCallback::OnStatsDelivered(
+    const RTCStatsReport& report) {
+  std::lock_guard<std::mutex> lk(mutex_);
+
+  if (!merged_) {
+    merged_ = webrtc::RTCStatsReport::Create(report->timestamp());
+  }
+  for (const auto& stats : *report) {
+    if (stats_type_selected(stats, type_mask_) && !merged_->Get(stats.id())) {
+      merged_->AddStats(stats.copy());
+    }
+  }
+
+  if (--pending_ == 0 && cb_) {
+    auto cb = std::move(*cb_);
+    cb_ = std::nullopt;
+
+    bridge::on_stats_delivered(std::move(cb),
+                               std::make_unique<RTCStatsReport>(merged_));
+  }
+}
+
 // Calls `PeerConnectionInterface->CreateOffer`.
 void create_offer(PeerConnectionInterface& peer_connection_interface,
                   const RTCOfferAnswerOptions& options,
@@ -270,4 +310,69 @@ void peer_connection_get_stats(const PeerConnectionInterface& peer,
   peer->GetStats(callback);
 }
 
+// Calls the selector-based `PeerConnectionInterface->GetStats` for the senders
+// and receivers of the tracks and transceivers with the provided IDs.
+//
+// A single report is propagated as is, since there is nothing to merge it
+// with.
+void peer_connection_get_selected_stats(
+    const PeerConnectionInterface& peer,
+    const rust::Vec<rust::String>& ids,
+    uint32_t type_mask,
+    rust::Box<DynRTCStatsCollectorCallback> cb) {
+  std::unordered_set<std::string> selected;
+  for (const auto& id : ids) {
+    selected.insert(std::string(id));
+  }
+
+  std::vector<rtc::scoped_refptr<webrtc::RtpSenderInterface>> senders;
+  std::vector<rtc::scoped_refptr<webrtc::RtpReceiverInterface>> receivers;
+  for (const auto& transceiver : peer->GetTransceivers()) {
+    const auto mid = transceiver->mid();
+    const auto whole = mid && selected.count(*mid) != 0;
+
+    auto sender = transceiver->sender();
+    auto sender_track = sender->track();
+    if (whole || (sender_track && selected.count(sender_track->id()) != 0)) {
+      senders.push_back(sender);
+    }
+
+    auto receiver = transceiver->receiver();
+    auto receiver_track = receiver->track();
+    if (whole ||
+        (receiver_track && selected.count(receiver_track->id()) != 0)) {
+      receivers.push_back(receiver);
+    }
+  }
+
+  if (senders.empty() && receivers.empty()) {
+    bridge::on_stats_delivered(
+        std::move(cb),
+        std::make_unique<RTCStatsReport>(webrtc::RTCStatsReport::Create(
+            webrtc::Timestamp::Micros(rtc::TimeUTCMicros()))));
+    return;
+  }
+
+  if (senders.size() + receivers.size() == 1) {
+    auto callback = rtc::scoped_refptr<RTCStatsCollectorCallback>(
+        new RTCStatsCollectorCallback(std::move(cb)));
+    if (senders.empty()) {
+      peer->GetStats(receivers.front(), callback);
+    } else {
+      peer->GetStats(senders.front(), callback);
+    }
+    return;
+  }
+
+  auto callback = rtc::scoped_refptr<MergingStatsCollectorCallback>(
+      new MergingStatsCollectorCallback(senders.size() + receivers.size(),
+                                        type_mask, std::move(cb)));
+  for (const auto& sender : senders) {
+    peer->GetStats(sender, callback);
+  }
+  for (const auto& receiver : receivers) {
+    peer->GetStats(receiver, callback);
+  }
+}
+
 }  // namespace bridge
@@ -16,20 +16,30 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cmath>
+
 #include "screen_video_capturer.h"
 #include "api/video/i420_buffer.h"
 #include "modules/desktop_capture/cropped_desktop_frame.h"
 #include "modules/desktop_capture/desktop_and_cursor_composer.h"
+#include "modules/desktop_capture/desktop_region.h"
 #include "rtc_base/logging.h"
-#include "system_wrappers/include/sleep.h"
 #include "third_party/libyuv/include/libyuv.h"
 
 #if __APPLE__
 #include "mouse_cursor_monitor_mac.h"
 #endif
 
-// Maximum allow CPU consumption for the frame capturing thread.
-const int maxCpuConsumptionPercentage = 50;
+// Maximum interval between two emitted frames when the screen doesn't change.
+const int64_t kMaxRepeatIntervalMs = 1000;
+
+// Maximum number of damaged rectangles processed separately, before they are
+// merged into their bounding rectangle.
+const int kMaxDamageRects = 64;
+
+// Number of pixels the scaled damaged rectangles are expanded by, to cover the
+// footprint of the scaling filter.
+const int kScaleFilterMargin = 2;
 
 namespace {
 
@@ -45,10 +55,60 @@ webrtc::DesktopCaptureOptions CreateDesktopCaptureOptions() {
 #ifdef WEBRTC_WIN
   options.set_allow_directx_capturer(true);
 #endif
+  // Makes capturers not reporting damage by themselves report only the changed
+  // blocks of the screen.
+  options.set_detect_updated_region(true);
 
   return options;
 }
 
+// Returns the bounding rectangle of the provided `region`, if it consists of
+// too many rectangles to be processed one by one.
+webrtc::DesktopRegion SimplifyRegion(const webrtc::DesktopRegion& region) {
+  int count = 0;
+  webrtc::DesktopRect bounds;
+  for (webrtc::DesktopRegion::Iterator it(region); !it.IsAtEnd();
+       it.Advance()) {
+    bounds.UnionWith(it.rect());
+    count++;
+  }
+  if (count <= kMaxDamageRects) {
+    return region;
+  }
+  return webrtc::DesktopRegion(bounds);
+}
+
+// Maps the provided `rect` of a `src` sized frame onto the `dst` sized one it
+// is scaled to.
+webrtc::DesktopRect ScaleRect(const webrtc::DesktopRect& rect,
+                              const webrtc::DesktopSize& src,
+                              const webrtc::DesktopSize& dst) {
+  int64_t left = (int64_t)rect.left() * dst.width() / src.width();
+  int64_t top = (int64_t)rect.top() * dst.height() / src.height();
+  int64_t right = ((int64_t)rect.right() * dst.width() + src.width() - 1) /
+                  src.width();
+  int64_t bottom = ((int64_t)rect.bottom() * dst.height() + src.height() - 1) /
+                   src.height();
+
+  webrtc::DesktopRect scaled = webrtc::DesktopRect::MakeLTRB(
+      (int32_t)left - kScaleFilterMargin, (int32_t)top - kScaleFilterMargin,
+      (int32_t)right + kScaleFilterMargin,
+      (int32_t)bottom + kScaleFilterMargin);
+  scaled.IntersectWith(webrtc::DesktopRect::MakeSize(dst));
+  return scaled;
+}
+
+// Expands the provided `rect` to even coordinates, so it covers whole chroma
+// samples of an `I420Buffer`.
+webrtc::DesktopRect AlignToChroma(const webrtc::DesktopRect& rect,
+                                  const webrtc::DesktopSize& size) {
+  webrtc::DesktopRect aligned = webrtc::DesktopRect::MakeLTRB(
+      rect.left() & ~1, rect.top() & ~1, (rect.right() + 1) & ~1,
+      (rect.bottom() + 1) & ~1);
+  aligned.IntersectWith(webrtc::DesktopRect::MakeSize(size));
+  return aligned;
+}
+
 }  // namespace
 
 // Fills the provided `SourceList` with all available screens that can be
@@ -62,15 +122,17 @@ bool ScreenVideoCapturer::GetSourceList(
   return screen_capturer->GetSourceList(sources);
 }
 
-// Creates a new `ScreenVideoCapturer` with the specified constraints.
+// Creates a new `ScreenVideoCapturer` with the specified constraints,
+// spending at most `cpu_budget_percentage` of a CPU core on capturing.
 ScreenVideoCapturer::ScreenVideoCapturer(
     webrtc::DesktopCapturer::SourceId source_id,
     size_t max_width,
     size_t max_height,
-    size_t target_fps)
+    size_t target_fps,
+    int cpu_budget_percentage)
     : max_width_(max_width),
       max_height_(max_height),
-      requested_frame_duration_((int) (1000.0f / target_fps)),
+      scheduler_((int)target_fps, cpu_budget_percentage),
       quit_(false) {
   if (capture_thread_.empty()) {
     capture_thread_ = rtc::PlatformThread::SpawnJoinable(
@@ -96,6 +158,7 @@ ScreenVideoCapturer::ScreenVideoCapturer(
           while (CaptureProcess()) {}
 
           output_frame_.reset();
+          last_buffer_ = nullptr;
           previous_frame_size_.set(0, 0);
           capturer_.reset();
         },
@@ -107,32 +170,44 @@ ScreenVideoCapturer::ScreenVideoCapturer(
 ScreenVideoCapturer::~ScreenVideoCapturer() {
   if (!capture_thread_.empty()) {
     quit_ = true;
+    stop_event_.Set();
     capture_thread_.Finalize();
   }
 }
 
-// Captures a `webrtc::DesktopFrame`.
+// Waits for the next deadline of the `scheduler_` and captures a
+// `webrtc::DesktopFrame`.
+//
+// The capture cost includes the conversion of the captured frame, as the
+// `DesktopCapturer` calls `OnCaptureResult()` synchronously.
 bool ScreenVideoCapturer::CaptureProcess() {
   if (quit_) {
     return false;
   }
 
+  // Sinks (e.g. an overusing encoder) may request a lower framerate, so there
+  // is no point in capturing frames that would be dropped anyway.
+  float max_fps = video_adapter()->GetMaxFramerate();
+  scheduler_.SetMaxFramerate(std::isfinite(max_fps) ? (int)max_fps : 0);
+
+  int64_t deadline_us = scheduler_.NextCaptureTimeUs(rtc::TimeMicros());
+  int64_t wait_us = deadline_us - rtc::TimeMicros();
+  if (wait_us > 0 && stop_event_.Wait(webrtc::TimeDelta::Micros(wait_us))) {
+    return false;
+  }
+  if (quit_) {
+    return false;
+  }
+
 #ifdef WEBRTC_MAC
   CFRunLoopRunInMode(kCFRunLoopDefaultMode, 0, true);
 #endif
 
-  int64_t started_time = rtc::TimeMillis();
+  int64_t started_us = rtc::TimeMicros();
   capturer_->CaptureFrame();
   mouse_monitor_->Capture();
+  scheduler_.OnCaptureDone(rtc::TimeMicros() - started_us);
 
-  int last_capture_duration = (int)(rtc::TimeMillis() - started_time);
-  int capture_period =
-      std::max((last_capture_duration * 100) / maxCpuConsumptionPercentage,
-               requested_frame_duration_);
-  int delta_time = capture_period - last_capture_duration;
-  if (delta_time > 0) {
-    webrtc::SleepMs(delta_time);
-  }
   return true;
 }
 
@@ -141,10 +216,61 @@ void ScreenVideoCapturer::OnFrame(const webrtc::VideoFrame& frame) {
   AdaptedVideoTrackSource::OnFrame(frame);
 }
 
+// Returns an `I420Buffer` to convert the damaged regions of the next frame
+// into.
+rtc::scoped_refptr<webrtc::I420Buffer> ScreenVideoCapturer::AcquireBuffer(
+    const webrtc::DesktopSize& size,
+    bool full_refresh) {
+  if (full_refresh) {
+    return buffer_pool_.Acquire(size.width(), size.height());
+  }
+  if (buffer_pool_.IsExclusive(last_buffer_)) {
+    return last_buffer_;
+  }
+
+  rtc::scoped_refptr<webrtc::I420Buffer> buffer =
+      buffer_pool_.Acquire(size.width(), size.height());
+  libyuv::I420Copy(last_buffer_->DataY(), last_buffer_->StrideY(),
+                   last_buffer_->DataU(), last_buffer_->StrideU(),
+                   last_buffer_->DataV(), last_buffer_->StrideV(),
+                   buffer->MutableDataY(), buffer->StrideY(),
+                   buffer->MutableDataU(), buffer->StrideU(),
+                   buffer->MutableDataV(), buffer->StrideV(), size.width(),
+                   size.height());
+  return buffer;
+}
+
+// Emits a `VideoFrame` with the provided `buffer` and remembers it as the
+// `last_buffer_`.
+void ScreenVideoCapturer::EmitFrame(
+    rtc::scoped_refptr<webrtc::I420Buffer> buffer) {
+  last_frame_time_ms_ = rtc::TimeMillis();
+  last_buffer_ = std::move(buffer);
+
+  webrtc::VideoFrame captureFrame = webrtc::VideoFrame::Builder()
+                                        .set_video_frame_buffer(last_buffer_)
+                                        .set_timestamp_rtp(0)
+                                        .set_timestamp_ms(last_frame_time_ms_)
+                                        .set_rotation(webrtc::kVideoRotation_0)
+                                        .build();
+
+  OnFrame(captureFrame);
+}
+
+// Re-emits the `last_buffer_` if nothing has been emitted for too long.
+//
+// The buffer is emitted as is, so repeating a frame costs no conversion.
+void ScreenVideoCapturer::RepeatLastFrame() {
+  if (rtc::TimeMillis() - last_frame_time_ms_ >= kMaxRepeatIntervalMs) {
+    EmitFrame(last_buffer_);
+  }
+}
+
 // Callback for `webrtc::DesktopCapturer::CaptureFrame`.
 //
-// Converts a `DesktopFrame` to a `VideoFrame` that is forwarded to
-// `ScreenVideoCapturer::OnFrame`.
+// Converts the damaged regions of a `DesktopFrame` into the `I420Buffer` of the
+// previous `VideoFrame`, and forwards the result to
+// `ScreenVideoCapturer::OnFrame`. Frames without any damage are skipped.
 void ScreenVideoCapturer::OnCaptureResult(
     webrtc::DesktopCapturer::Result result,
     std::unique_ptr<webrtc::DesktopFrame> frame) {
@@ -155,6 +281,7 @@ void ScreenVideoCapturer::OnCaptureResult(
     return;
   }
 
+  bool full_refresh = !last_buffer_;
   if (!previous_frame_size_.equals(frame->size())) {
     output_frame_.reset();
     capture_width_ = frame->size().width();
@@ -171,6 +298,7 @@ void ScreenVideoCapturer::OnCaptureResult(
     }
 
     previous_frame_size_ = frame->size();
+    full_refresh = true;
   }
 
   webrtc::DesktopSize output_size(capture_width_ & ~1, capture_height_ & ~1);
@@ -178,78 +306,127 @@ void ScreenVideoCapturer::OnCaptureResult(
     output_size.set(2, 2);
   }
 
-  rtc::scoped_refptr<webrtc::I420Buffer> dst_buffer(
-      webrtc::I420Buffer::Create(output_size.width(), output_size.height()));
-  dst_buffer->InitializeData();
-
   if (frame->size().width() <= 2 || frame->size().height() <= 1) {
-  } else {
-    const int32_t frame_width = frame->size().width();
-    const int32_t frame_height = frame->size().height();
+    if (full_refresh) {
+      rtc::scoped_refptr<webrtc::I420Buffer> dst_buffer =
+          AcquireBuffer(output_size, true);
+      dst_buffer->InitializeData();
+      EmitFrame(std::move(dst_buffer));
+    } else {
+      RepeatLastFrame();
+    }
+    return;
+  }
 
-    if (frame_width & 1 || frame_height & 1) {
-      frame = webrtc::CreateCroppedDesktopFrame(
-          std::move(frame),
-          webrtc::DesktopRect::MakeWH(frame_width & ~1, frame_height & ~1));
+  const int32_t frame_width = frame->size().width();
+  const int32_t frame_height = frame->size().height();
+  const webrtc::DesktopRect frame_rect =
+      webrtc::DesktopRect::MakeWH(frame_width & ~1, frame_height & ~1);
+
+  webrtc::DesktopRegion damage(frame_rect);
+  if (!full_refresh) {
+    damage = frame->updated_region();
+    damage.IntersectWith(frame_rect);
+    if (damage.is_empty()) {
+      RepeatLastFrame();
+      return;
     }
+    damage = SimplifyRegion(damage);
+  }
 
-    const uint8_t* output_data = nullptr;
-    int output_stride = 0;
-    if (!frame->size().equals(output_size)) {
-      if (!output_frame_) {
-        output_frame_.reset(new webrtc::BasicDesktopFrame(output_size));
-      }
-      webrtc::DesktopRect output_rect;
-      if ((float)output_size.width() / (float)output_size.height() <
-          (float)frame->size().width() / (float)frame->size().height()) {
-        int32_t output_height = frame->size().height() * output_size.width() /
-                                frame->size().width();
-        if (output_height > output_size.height())
-          output_height = output_size.height();
-        const int32_t margin_y = (output_size.height() - output_height) / 2;
-        output_rect = webrtc::DesktopRect::MakeLTRB(
-            0, margin_y, output_size.width(), output_height + margin_y);
-      } else {
-        int32_t output_width = frame->size().width() * output_size.height() /
-                               frame->size().height();
-        if (output_width > output_size.width())
-          output_width = output_size.width();
-        const int32_t margin_x = (output_size.width() - output_width) / 2;
-        output_rect = webrtc::DesktopRect::MakeLTRB(
-            margin_x, 0, output_width + margin_x, output_size.height());
+  if (frame_width & 1 || frame_height & 1) {
+    frame = webrtc::CreateCroppedDesktopFrame(std::move(frame), frame_rect);
+  }
+
+  const uint8_t* output_data = nullptr;
+  int output_stride = 0;
+  if (!frame->size().equals(output_size)) {
+    if (!output_frame_) {
+      output_frame_.reset(new webrtc::BasicDesktopFrame(output_size));
+    }
+    webrtc::DesktopRect output_rect;
+    if ((float)output_size.width() / (float)output_size.height() <
+        (float)frame->size().width() / (float)frame->size().height()) {
+      int32_t output_height = frame->size().height() * output_size.width() /
+                              frame->size().width();
+      if (output_height > output_size.height())
+        output_height = output_size.height();
+      const int32_t margin_y = (output_size.height() - output_height) / 2;
+      output_rect = webrtc::DesktopRect::MakeLTRB(
+          0, margin_y, output_size.width(), output_height + margin_y);
+    } else {
+      int32_t output_width = frame->size().width() * output_size.height() /
+                             frame->size().height();
+      if (output_width > output_size.width())
+        output_width = output_size.width();
+      const int32_t margin_x = (output_size.width() - output_width) / 2;
+      output_rect = webrtc::DesktopRect::MakeLTRB(
+          margin_x, 0, output_width + margin_x, output_size.height());
+    }
+    uint8_t* output_rect_data =
+        output_frame_->GetFrameDataAtPos(output_rect.top_left());
+
+    // Only the damaged rectangles are rescaled, the rest of the `output_frame_`
+    // still holds the previous frame.
+    webrtc::DesktopRegion scaled_damage;
+    for (webrtc::DesktopRegion::Iterator it(damage); !it.IsAtEnd();
+         it.Advance()) {
+      webrtc::DesktopRect rect =
+          ScaleRect(it.rect(), frame->size(), output_rect.size());
+      if (rect.is_empty()) {
+        continue;
       }
-      uint8_t* output_rect_data =
-          output_frame_->GetFrameDataAtPos(output_rect.top_left());
-      libyuv::ARGBScale(frame->data(), frame->stride(), frame->size().width(),
-                        frame->size().height(), output_rect_data,
-                        output_frame_->stride(), output_rect.width(),
-                        output_rect.height(), libyuv::kFilterBox);
-      output_data = output_frame_->data();
-      output_stride = output_frame_->stride();
+      libyuv::ARGBScaleClip(
+          frame->data(), frame->stride(), frame->size().width(),
+          frame->size().height(), output_rect_data, output_frame_->stride(),
+          output_rect.width(), output_rect.height(), rect.left(), rect.top(),
+          rect.width(), rect.height(), libyuv::kFilterBox);
+      scaled_damage.AddRect(rect);
+    }
+    scaled_damage.Translate(output_rect.left(), output_rect.top());
+
+    if (full_refresh) {
+      damage.SetRect(webrtc::DesktopRect::MakeSize(output_size));
     } else {
-      output_data = frame->data();
-      output_stride = frame->stride();
+      damage.Swap(&scaled_damage);
     }
+    output_data = output_frame_->data();
+    output_stride = output_frame_->stride();
+  } else {
+    output_data = frame->data();
+    output_stride = frame->stride();
+  }
 
+  rtc::scoped_refptr<webrtc::I420Buffer> dst_buffer =
+      AcquireBuffer(output_size, full_refresh);
+
+  for (webrtc::DesktopRegion::Iterator it(damage); !it.IsAtEnd();
+       it.Advance()) {
+    webrtc::DesktopRect rect = AlignToChroma(it.rect(), output_size);
+    if (rect.is_empty()) {
+      continue;
+    }
+    const int32_t x = rect.left();
+    const int32_t y = rect.top();
     if (libyuv::ARGBToI420(
-            output_data, output_stride, dst_buffer.get()->MutableDataY(),
-            dst_buffer.get()->StrideY(), dst_buffer.get()->MutableDataU(),
-            dst_buffer.get()->StrideU(), dst_buffer.get()->MutableDataV(),
-            dst_buffer.get()->StrideV(), output_size.width(),
-            output_size.height()) < 0) {
+            output_data + y * output_stride +
+                x * webrtc::DesktopFrame::kBytesPerPixel,
+            output_stride,
+            dst_buffer->MutableDataY() + y * dst_buffer->StrideY() + x,
+            dst_buffer->StrideY(),
+            dst_buffer->MutableDataU() + y / 2 * dst_buffer->StrideU() + x / 2,
+            dst_buffer->StrideU(),
+            dst_buffer->MutableDataV() + y / 2 * dst_buffer->StrideV() + x / 2,
+            dst_buffer->StrideV(), rect.width(), rect.height()) < 0) {
       RTC_LOG(LS_ERROR) << "ConvertToI420 Failed";
+      // The buffer may be partially converted now, so the next frame must be
+      // converted as a whole.
+      last_buffer_ = nullptr;
       return;
     }
   }
 
-  webrtc::VideoFrame captureFrame = webrtc::VideoFrame::Builder()
-                                        .set_video_frame_buffer(dst_buffer)
-                                        .set_timestamp_rtp(0)
-                                        .set_timestamp_ms(rtc::TimeMillis())
-                                        .set_rotation(webrtc::kVideoRotation_0)
-                                        .build();
-
-  OnFrame(captureFrame);
+  EmitFrame(std::move(dst_buffer));
 }
 
 // Always returns `true`.
@@ -1,8 +1,154 @@
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 #include "libwebrtc-sys/src/bridge.rs.h"
 #include "stats.h"
 
 namespace bridge {
 
+namespace {
+
+// Returns the `RTCStatsType` of the provided `RTCStats`.
+RTCStatsType stats_type_of(const RTCStats& stats) {
+  static const std::unordered_map<std::string_view, RTCStatsType> kTypes = {
+      {"media-source", RTCStatsType::RTCMediaSourceStats},
+      {"local-candidate", RTCStatsType::RTCIceCandidateStats},
+      {"remote-candidate", RTCStatsType::RTCIceCandidateStats},
+      {"outbound-rtp", RTCStatsType::RTCOutboundRTPStreamStats},
+      {"inbound-rtp", RTCStatsType::RTCInboundRTPStreamStats},
+      {"candidate-pair", RTCStatsType::RTCIceCandidatePairStats},
+      {"transport", RTCStatsType::RTCTransportStats},
+      {"remote-inbound-rtp", RTCStatsType::RTCRemoteInboundRtpStreamStats},
+      {"remote-outbound-rtp", RTCStatsType::RTCRemoteOutboundRtpStreamStats},
+  };
+
+  const auto it = kTypes.find(stats.type());
+  return it == kTypes.end() ? RTCStatsType::Unimplemented : it->second;
+}
+
+// Indicates whether the provided `RTCStatsType` is in the `type_mask`.
+bool type_mask_contains(uint32_t type_mask, RTCStatsType type) {
+  return (type_mask & (1u << static_cast<uint32_t>(type))) != 0;
+}
+
+// Returns the `RTCStatsColumn` of the `RTCStats` member with the provided
+// `name`, or `nullptr` if it has none.
+const RTCStatsColumn* stats_column_of(std::string_view name) {
+  static const std::unordered_map<std::string_view, RTCStatsColumn> kColumns =
+      {
+      {"bytesSent", RTCStatsColumn::BytesSent},
+      {"bytesReceived", RTCStatsColumn::BytesReceived},
+      {"headerBytesSent", RTCStatsColumn::HeaderBytesSent},
+      {"headerBytesReceived", RTCStatsColumn::HeaderBytesReceived},
+      {"packetsSent", RTCStatsColumn::PacketsSent},
+      {"packetsReceived", RTCStatsColumn::PacketsReceived},
+      {"packetsLost", RTCStatsColumn::PacketsLost},
+      {"retransmittedPacketsSent", RTCStatsColumn::RetransmittedPacketsSent},
+      {"retransmittedBytesSent", RTCStatsColumn::RetransmittedBytesSent},
+      {"nackCount", RTCStatsColumn::NackCount},
+      {"firCount", RTCStatsColumn::FirCount},
+      {"pliCount", RTCStatsColumn::PliCount},
+      {"jitter", RTCStatsColumn::Jitter},
+      {"jitterBufferDelay", RTCStatsColumn::JitterBufferDelay},
+      {"jitterBufferEmittedCount", RTCStatsColumn::JitterBufferEmittedCount},
+      {"frameWidth", RTCStatsColumn::FrameWidth},
+      {"frameHeight", RTCStatsColumn::FrameHeight},
+      {"framesPerSecond", RTCStatsColumn::FramesPerSecond},
+      {"framesSent", RTCStatsColumn::FramesSent},
+      {"framesEncoded", RTCStatsColumn::FramesEncoded},
+      {"framesReceived", RTCStatsColumn::FramesReceived},
+      {"framesDecoded", RTCStatsColumn::FramesDecoded},
+      {"keyFramesDecoded", RTCStatsColumn::KeyFramesDecoded},
+      {"framesDropped", RTCStatsColumn::FramesDropped},
+      {"qpSum", RTCStatsColumn::QpSum},
+      {"totalEncodeTime", RTCStatsColumn::TotalEncodeTime},
+      {"totalDecodeTime", RTCStatsColumn::TotalDecodeTime},
+      {"totalInterFrameDelay", RTCStatsColumn::TotalInterFrameDelay},
+      {"freezeCount", RTCStatsColumn::FreezeCount},
+      {"totalFreezesDuration", RTCStatsColumn::TotalFreezesDuration},
+      {"targetBitrate", RTCStatsColumn::TargetBitrate},
+      {"totalSamplesReceived", RTCStatsColumn::TotalSamplesReceived},
+      {"concealedSamples", RTCStatsColumn::ConcealedSamples},
+      {"silentConcealedSamples", RTCStatsColumn::SilentConcealedSamples},
+      {"concealmentEvents", RTCStatsColumn::ConcealmentEvents},
+      {"audioLevel", RTCStatsColumn::AudioLevel},
+      {"totalAudioEnergy", RTCStatsColumn::TotalAudioEnergy},
+      {"totalSamplesDuration", RTCStatsColumn::TotalSamplesDuration},
+      {"echoReturnLoss", RTCStatsColumn::EchoReturnLoss},
+      {"echoReturnLossEnhancement", RTCStatsColumn::EchoReturnLossEnhancement},
+      {"width", RTCStatsColumn::Width},
+      {"height", RTCStatsColumn::Height},
+      {"frames", RTCStatsColumn::Frames},
+      {"roundTripTime", RTCStatsColumn::RoundTripTime},
+      {"totalRoundTripTime", RTCStatsColumn::TotalRoundTripTime},
+      {"currentRoundTripTime", RTCStatsColumn::CurrentRoundTripTime},
+      {"roundTripTimeMeasurements", RTCStatsColumn::RoundTripTimeMeasurements},
+      {"fractionLost", RTCStatsColumn::FractionLost},
+      {"availableOutgoingBitrate", RTCStatsColumn::AvailableOutgoingBitrate},
+      {"availableIncomingBitrate", RTCStatsColumn::AvailableIncomingBitrate},
+      {"nominated", RTCStatsColumn::Nominated},
+      {"reportsSent", RTCStatsColumn::ReportsSent},
+      {"remoteTimestamp", RTCStatsColumn::RemoteTimestamp},
+      {"ssrc", RTCStatsColumn::Ssrc},
+      {"port", RTCStatsColumn::Port},
+      {"priority", RTCStatsColumn::Priority},
+      {"kind", RTCStatsColumn::Kind},
+      {"mid", RTCStatsColumn::Mid},
+      {"rid", RTCStatsColumn::Rid},
+      {"trackIdentifier", RTCStatsColumn::TrackIdentifier},
+      {"mediaSourceId", RTCStatsColumn::MediaSourceId},
+      {"transportId", RTCStatsColumn::TransportId},
+      {"codecId", RTCStatsColumn::CodecId},
+      {"remoteId", RTCStatsColumn::RemoteId},
+      {"localId", RTCStatsColumn::LocalId},
+      {"state", RTCStatsColumn::State},
+      {"address", RTCStatsColumn::Address},
+      {"protocol", RTCStatsColumn::Protocol},
+      {"candidateType", RTCStatsColumn::CandidateType},
+      {"url", RTCStatsColumn::Url},
+      {"qualityLimitationReason", RTCStatsColumn::QualityLimitationReason},
+      };
+
+  const auto it = kColumns.find(name);
+  return it == kColumns.end() ? nullptr : &it->second;
+}
+
+// Converts the provided defined numeric `member` into a `double`.
+//
+// Returns `false` if the `member` isn't numeric.
+bool numeric_value_of(const webrtc::RTCStatsMemberInterface& member,
+                      double* value) {
+  using Type = webrtc::RTCStatsMemberInterface::Type;
+  switch (member.type()) {
+    case Type::kBool:
+      *value = *member.cast_to<webrtc::RTCStatsMember<bool>>() ? 1 : 0;
+      return true;
+    case Type::kInt32:
+      *value = *member.cast_to<webrtc::RTCStatsMember<int32_t>>();
+      return true;
+    case Type::kUint32:
+      *value = *member.cast_to<webrtc::RTCStatsMember<uint32_t>>();
+      return true;
+    case Type::kInt64:
+      *value = static_cast<double>(
+          *member.cast_to<webrtc::RTCStatsMember<int64_t>>());
+      return true;
+    case Type::kUint64:
+      *value = static_cast<double>(
+          *member.cast_to<webrtc::RTCStatsMember<uint64_t>>());
+      return true;
+    case Type::kDouble:
+      *value = *member.cast_to<webrtc::RTCStatsMember<double>>();
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
 // Tries to cast `RTCStats` into wrapped `RTCMediaSourceStats`.
 RTCMediaSourceStatsWrap cast_to_rtc_media_source_stats(
     std::unique_ptr<RTCStats> stats) {
@@ -553,34 +699,25 @@ RTCAudioSourceStatsWrap cast_to_rtc_audio_source_stats(
                               kind);
 }
 
-// Returns collection of wrapped `RTCStats` of the provided `RTCStatsReport`.
-rust::Vec<RTCStatsWrap> rtc_stats_report_get_stats(
-    const RTCStatsReport& report) {
+// Indicates whether the `RTCStatsType` of the provided `RTCStats` is in the
+// `type_mask`.
+bool stats_type_selected(const RTCStats& stats, uint32_t type_mask) {
+  return type_mask_contains(type_mask, stats_type_of(stats));
+}
+
+// Returns collection of wrapped `RTCStats` of the provided `RTCStatsReport`,
+// having their `RTCStatsType` in the provided `type_mask`.
+//
+// Stats of other types are skipped before being copied.
+rust::Vec<RTCStatsWrap> rtc_stats_report_get_stats(const RTCStatsReport& report,
+                                                   uint32_t type_mask) {
   rust::Vec<RTCStatsWrap> stats_result;
+  stats_result.reserve(report->size());
 
   for (const RTCStats& stats : *report) {
-    auto type_str = stats.type();
-    RTCStatsType type;
-
-    if (strcmp(type_str, "media-source") == 0) {
-      type = RTCStatsType::RTCMediaSourceStats;
-    } else if (strcmp(type_str, "local-candidate") == 0 ||
-               strcmp(type_str, "remote-candidate") == 0) {
-      type = RTCStatsType::RTCIceCandidateStats;
-    } else if (strcmp(type_str, "outbound-rtp") == 0) {
-      type = RTCStatsType::RTCOutboundRTPStreamStats;
-    } else if (strcmp(type_str, "inbound-rtp") == 0) {
-      type = RTCStatsType::RTCInboundRTPStreamStats;
-    } else if (strcmp(type_str, "candidate-pair") == 0) {
-      type = RTCStatsType::RTCIceCandidatePairStats;
-    } else if (strcmp(type_str, "transport") == 0) {
-      type = RTCStatsType::RTCTransportStats;
-    } else if (strcmp(type_str, "remote-inbound-rtp") == 0) {
-      type = RTCStatsType::RTCRemoteInboundRtpStreamStats;
-    } else if (strcmp(type_str, "remote-outbound-rtp") == 0) {
-      type = RTCStatsType::RTCRemoteOutboundRtpStreamStats;
-    } else {
-      type = RTCStatsType::Unimplemented;
+    const auto type = stats_type_of(stats);
+    if (!type_mask_contains(type_mask, type)) {
+      continue;
     }
 
     RTCStatsWrap wrap_stat = {rust::String(stats.id()), stats.timestamp().us(),
@@ -590,4 +727,152 @@ rust::Vec<RTCStatsWrap> rtc_stats_report_get_stats(
   return stats_result;
 }
 
+// Returns collection of wrapped `RTCStats` of the provided `RTCStatsReport`
+// with the provided `ids`, skipping the missing ones.
+//
+// Only the requested `RTCStats` are copied, so the rest of the report is left
+// untouched.
+rust::Vec<RTCStatsWrap> rtc_stats_report_get_stats_by_ids(
+    const RTCStatsReport& report,
+    rust::Slice<const rust::String> ids) {
+  rust::Vec<RTCStatsWrap> stats_result;
+  stats_result.reserve(ids.size());
+
+  for (const auto& id : ids) {
+    const auto* stats = report->Get(std::string(id));
+    if (stats == nullptr) {
+      continue;
+    }
+
+    RTCStatsWrap wrap_stat = {rust::String(stats->id()),
+                              stats->timestamp().us(), stats_type_of(*stats),
+                              stats->copy()};
+    stats_result.push_back(std::move(wrap_stat));
+  }
+  return stats_result;
+}
+
+// Returns `RTCStatsColumns` of the `RTCStats` of the provided `RTCStatsReport`,
+// having their `RTCStatsType` in the provided `type_mask`.
+//
+// Rows are counted beforehand, so every buffer is allocated exactly once.
+// Columns of the `RTCStats::Members()` are resolved by their names for the
+// first row of each stats type only, and the following rows of that type reuse
+// the resolved member indices.
+RTCStatsColumns rtc_stats_report_get_columns(const RTCStatsReport& report,
+                                             uint32_t type_mask) {
+  const auto columns =
+      static_cast<size_t>(RTCStatsColumn::QualityLimitationReason) + 1;
+
+  size_t rows = 0;
+  for (const RTCStats& stats : *report) {
+    if (type_mask_contains(type_mask, stats_type_of(stats))) {
+      ++rows;
+    }
+  }
+  const auto cells = rows * columns;
+  const auto presence_words = (cells + 63) / 64;
+
+  RTCStatsColumns result;
+  result.rows = rows;
+  result.columns = columns;
+  result.kinds.reserve(rows);
+  result.ids.reserve(rows);
+  result.timestamps_us.reserve(rows);
+  result.values.reserve(cells);
+  for (size_t i = 0; i < cells; ++i) {
+    result.values.push_back(0);
+  }
+  result.presence.reserve(presence_words);
+  for (size_t i = 0; i < presence_words; ++i) {
+    result.presence.push_back(0);
+  }
+
+  // IDs, kinds, codec and transport IDs repeat a lot between the rows, so
+  // each distinct string is transferred only once.
+  std::unordered_map<std::string, uint32_t> interned;
+  auto intern = [&](const std::string& string) {
+    const auto it =
+        interned.emplace(string, static_cast<uint32_t>(interned.size()));
+    if (it.second) {
+      result.strings.push_back(rust::String(string));
+    }
+    return it.first->second;
+  };
+
+  // Member of a stats type having a column, located by its index in the
+  // `RTCStats::Members()`.
+  struct MemberColumn {
+    size_t index;
+    RTCStatsColumn column;
+  };
+
+  // `MemberColumn`s of a stats type.
+  struct Layout {
+    // Number of the `RTCStats::Members()` the `columns` are resolved for.
+    size_t members = 0;
+
+    // `MemberColumn`s of the members having a column.
+    std::vector<MemberColumn> columns;
+  };
+
+  // `Layout`s of the already seen stats types, keyed by their
+  // `RTCStats::type()` names.
+  //
+  // All the `RTCStats` with the same type name are of the same class, listing
+  // the same members in the same order, which is double-checked by the number
+  // of their members.
+  std::unordered_map<std::string_view, Layout> layouts;
+
+  size_t row = 0;
+  for (const RTCStats& stats : *report) {
+    const auto type = stats_type_of(stats);
+    if (!type_mask_contains(type_mask, type)) {
+      continue;
+    }
+
+    result.kinds.push_back(static_cast<int32_t>(type));
+    result.ids.push_back(intern(stats.id()));
+    result.timestamps_us.push_back(stats.timestamp().us());
+
+    const auto members = stats.Members();
+    auto& layout = layouts[stats.type()];
+    if (layout.members != members.size()) {
+      layout.members = members.size();
+      layout.columns.clear();
+      for (size_t i = 0; i < members.size(); ++i) {
+        const auto* column = stats_column_of(members[i]->name());
+        if (column != nullptr) {
+          layout.columns.push_back({i, *column});
+        }
+      }
+    }
+
+    for (const auto& [index, column] : layout.columns) {
+      const auto* member = members[index];
+      if (!member->is_defined()) {
+        continue;
+      }
+
+      double value;
+      if (column >= RTCStatsColumn::Kind) {
+        if (member->type() != webrtc::RTCStatsMemberInterface::kString) {
+          continue;
+        }
+        value = intern(*member->cast_to<webrtc::RTCStatsMember<std::string>>());
+      } else if (!numeric_value_of(*member, &value)) {
+        continue;
+      }
+
+      const auto index = static_cast<size_t>(column) * rows + row;
+      result.values[index] = value;
+      result.presence[index / 64] |= uint64_t{1} << (index % 64);
+    }
+
+    ++row;
+  }
+
+  return result;
+}
+
 }  // namespace bridge
@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "api/make_ref_counted.h"
+#include "common_audio/wav_file.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/system/file_wrapper.h"
+#include "rtc_base/time_utils.h"
+#include "synthetic_audio_source.h"
+
+namespace bridge {
+
+namespace {
+
+// Duration of a single produced block, in milliseconds.
+const int64_t kBlockMs = 10;
+
+// Sample rate of the generated signals.
+const int kGeneratedSampleRate = 48000;
+
+// Amplitudes of the generated signals and the markers, relative to the full
+// scale.
+const double kSignalAmplitude = 0.25;
+const double kMarkerAmplitude = 0.9;
+
+// Maximum number of missed blocks produced at once after the timer thread has
+// been delayed. Delays longer than this are skipped, so sinks aren't flooded
+// after e.g. the process has been suspended.
+const int64_t kMaxCatchUpBlocks = 10;
+
+// Seed of the noise generator.
+const uint64_t kNoiseSeed = 0x9E3779B97F4A7C15ULL;
+
+const double kPi = 3.14159265358979323846;
+
+// Single thread producing the 10 ms blocks of all the `SyntheticAudioSource`s.
+class SyntheticAudioTimer {
+ public:
+  // Returns the process-wide `SyntheticAudioTimer`.
+  //
+  // It's never destroyed, as its thread idles while there are no sources.
+  static SyntheticAudioTimer& Instance() {
+    static auto* timer = new SyntheticAudioTimer();
+    return *timer;
+  }
+
+  // Starts producing blocks of the provided `source`.
+  void Register(SyntheticAudioSource* source) {
+    {
+      std::lock_guard<std::mutex> lk(_mutex);
+      _sources.insert(source);
+    }
+    _wakeup.notify_one();
+  }
+
+  // Stops producing blocks of the provided `source`.
+  //
+  // Waits for the blocks being produced to finish, so once this returns, the
+  // `source` is guaranteed not to be used anymore. Must not be called from the
+  // timer thread.
+  void Unregister(SyntheticAudioSource* source) {
+    std::unique_lock<std::mutex> lk(_mutex);
+    _sources.erase(source);
+    _idle.wait(lk, [this] { return !_producing; });
+  }
+
+ private:
+  SyntheticAudioTimer() {
+    rtc::PlatformThread::SpawnDetached([this] { run(); },
+                                       "synthetic_audio_timer",
+                                       rtc::ThreadAttributes().SetPriority(
+                                           rtc::ThreadPriority::kRealtime));
+  }
+
+  // Produces the blocks of all the registered sources every 10 ms.
+  //
+  // Sources are snapshotted under the `_mutex`, while their blocks are
+  // produced outside of it, so registering sources never waits for the sinks.
+  void run() {
+    int64_t next_tick_ms = 0;
+    int64_t now_ms = 0;
+    std::vector<SyntheticAudioSource*> sources;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lk(_mutex);
+        _producing = false;
+        _idle.notify_all();
+
+        if (_sources.empty()) {
+          _wakeup.wait(lk, [this] { return !_sources.empty(); });
+          next_tick_ms = rtc::TimeMillis();
+        }
+
+        now_ms = rtc::TimeMillis();
+        if (next_tick_ms > now_ms) {
+          _wakeup.wait_for(lk,
+                           std::chrono::milliseconds(next_tick_ms - now_ms));
+          continue;
+        }
+
+        sources.assign(_sources.begin(), _sources.end());
+        _producing = true;
+      }
+
+      // Ticks are kept on the grid of the first one, so exactly 100 blocks
+      // are produced per second regardless of the scheduling jitter.
+      if (now_ms - next_tick_ms > kMaxCatchUpBlocks * kBlockMs) {
+        next_tick_ms = now_ms;
+      }
+      while (next_tick_ms <= now_ms) {
+        for (auto* source : sources) {
+          source->ProduceBlock(next_tick_ms);
+        }
+        next_tick_ms += kBlockMs;
+      }
+    }
+  }
+
+  // Mutex guarding the `_sources` and the `_producing` flag.
+  std::mutex _mutex;
+
+  // Condition variable waking up the timer thread once a source is added.
+  std::condition_variable _wakeup;
+
+  // Condition variable notified once the snapshotted sources are produced.
+  std::condition_variable _idle;
+
+  // Sources to produce blocks of.
+  std::unordered_set<SyntheticAudioSource*> _sources;
+
+  // Indicator whether the blocks of the snapshotted sources are being
+  // produced outside of the `_mutex`.
+  bool _producing = false;
+};
+
+}  // namespace
+
+rtc::scoped_refptr<SyntheticAudioSource> SyntheticAudioSource::Create(
+    SyntheticAudioOptions options) {
+  int sample_rate = kGeneratedSampleRate;
+  size_t channels = 1;
+  std::vector<int16_t> wav_samples;
+  if (options.signal == SyntheticSignal::kWavFile) {
+    auto file = webrtc::FileWrapper::OpenReadOnly(options.wavPath);
+    if (!file.is_open()) {
+      RTC_LOG(LS_ERROR) << "Could not open WAV file: " << options.wavPath;
+      return nullptr;
+    }
+    webrtc::WavReader wav(std::move(file));
+    if (wav.num_samples() == 0 || wav.num_channels() > 2 ||
+        wav.sample_rate() % 100 != 0) {
+      RTC_LOG(LS_ERROR) << "Unsupported WAV file: " << options.wavPath;
+      return nullptr;
+    }
+
+    // The whole file is read here, so the timer thread never does any I/O.
+    wav_samples.resize(wav.num_samples());
+    if (wav.ReadSamples(wav_samples.size(), wav_samples.data()) !=
+        wav_samples.size()) {
+      RTC_LOG(LS_ERROR) << "Could not read WAV file: " << options.wavPath;
+      return nullptr;
+    }
+    sample_rate = wav.sample_rate();
+    channels = wav.num_channels();
+  }
+
+  auto source = rtc::make_ref_counted<SyntheticAudioSource>(
+      options, sample_rate, channels, std::move(wav_samples));
+  SyntheticAudioTimer::Instance().Register(source.get());
+  return source;
+}
+
+SyntheticAudioSource::SyntheticAudioSource(SyntheticAudioOptions options,
+                                           int sample_rate,
+                                           size_t channels,
+                                           std::vector<int16_t> wav_samples)
+    : _options(std::move(options)),
+      _wavSamples(std::move(wav_samples)),
+      _sampleRate(sample_rate),
+      _channels(channels),
+      _block(_sampleRate / 100 * _channels),
+      _noiseState(kNoiseSeed) {}
+
+SyntheticAudioSource::~SyntheticAudioSource() {
+  SyntheticAudioTimer::Instance().Unregister(this);
+}
+
+// Produces the next 10 ms block captured at the provided monotonic time.
+void SyntheticAudioSource::ProduceBlock(int64_t capture_time_ms) {
+  // The signal advances under markers too, so it stays aligned with the
+  // capture time.
+  if (!_wavSamples.empty()) {
+    readWav();
+  } else {
+    generateSignal();
+  }
+
+  const auto markerBlocks = _options.markerIntervalMs / kBlockMs;
+  if (markerBlocks > 0 && _blockNumber % markerBlocks == 0) {
+    drawMarker();
+  }
+
+  OnData(_block.data(), 16, _sampleRate, _channels, _sampleRate / 100,
+         capture_time_ms);
+  ++_blockNumber;
+}
+
+// Writes the next samples of the generated signal into the `_block`.
+void SyntheticAudioSource::generateSignal() {
+  const auto amplitude = kSignalAmplitude * INT16_MAX;
+
+  // Generated signals are mono, so each sample is a frame.
+  const auto sweepSamples =
+      static_cast<uint64_t>(kSweepDurationMs) * _sampleRate / 1000;
+  for (size_t i = 0; i < _block.size(); ++i) {
+    auto& sample = _block[i];
+    switch (_options.signal) {
+      case SyntheticSignal::kSine:
+        sample = static_cast<int16_t>(amplitude * std::sin(_phase));
+        _phase += 2 * kPi * _options.frequencyHz / _sampleRate;
+        break;
+
+      case SyntheticSignal::kSweep: {
+        const auto position =
+            static_cast<double>((_blockNumber * _block.size() + i) %
+                                sweepSamples) /
+            sweepSamples;
+        const auto frequency =
+            kSweepStartHz + (kSweepEndHz - kSweepStartHz) * position;
+        sample = static_cast<int16_t>(amplitude * std::sin(_phase));
+        _phase += 2 * kPi * frequency / _sampleRate;
+        break;
+      }
+
+      case SyntheticSignal::kNoise:
+        // `xorshift64*` generator.
+        _noiseState ^= _noiseState >> 12;
+        _noiseState ^= _noiseState << 25;
+        _noiseState ^= _noiseState >> 27;
+        sample = static_cast<int16_t>(
+            static_cast<int16_t>((_noiseState * 0x2545F4914F6CDD1DULL) >> 48) *
+            kSignalAmplitude);
+        break;
+
+      case SyntheticSignal::kSilence:
+      case SyntheticSignal::kWavFile:
+        sample = 0;
+        break;
+    }
+  }
+  _phase = std::fmod(_phase, 2 * kPi);
+}
+
+// Copies the next samples of the looped WAV file into the `_block`.
+void SyntheticAudioSource::readWav() {
+  size_t read = 0;
+  while (read < _block.size()) {
+    const auto count =
+        std::min(_block.size() - read, _wavSamples.size() - _wavPosition);
+    std::copy_n(_wavSamples.begin() + _wavPosition, count,
+                _block.begin() + read);
+    _wavPosition = (_wavPosition + count) % _wavSamples.size();
+    read += count;
+  }
+}
+
+// Overwrites the `_block` with the marker tone.
+void SyntheticAudioSource::drawMarker() {
+  const auto amplitude = kMarkerAmplitude * INT16_MAX;
+  const auto frames = _block.size() / _channels;
+
+  for (size_t i = 0; i < frames; ++i) {
+    const auto sample = static_cast<int16_t>(
+        amplitude * std::sin(2 * kPi * kMarkerFrequencyHz * i / _sampleRate));
+    for (size_t c = 0; c < _channels; ++c) {
+      _block[i * _channels + c] = sample;
+    }
+  }
+}
+
+}  // namespace bridge
@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <utility>
+
+#include "api/video_codecs/video_encoder.h"
+#include "modules/video_coding/svc/scalability_mode_util.h"
+#include "video_codec_factory.h"
+
+namespace {
+
+// Returns the `VideoCodecPreference` of the codec of the provided `format`
+// along with its preference rank, or `nullptr` if the codec is disabled.
+const VideoCodecPreference* FindPreference(
+    const VideoCodecPreferences& preferences,
+    const webrtc::SdpVideoFormat& format,
+    size_t* rank) {
+  const auto type = webrtc::PayloadStringToCodecType(format.name);
+  for (size_t i = 0; i < preferences.codecs.size(); ++i) {
+    if (preferences.codecs[i].type == type) {
+      if (rank) {
+        *rank = i;
+      }
+      return &preferences.codecs[i];
+    }
+  }
+  return nullptr;
+}
+
+// Indicates whether the provided `mode` has multiple spatial layers.
+bool IsSpatial(webrtc::ScalabilityMode mode) {
+  return webrtc::ScalabilityModeToNumSpatialLayers(mode) > 1;
+}
+
+// Drops the formats of the disabled codecs from the provided `formats`, and
+// orders the rest according to the `preferences`.
+//
+// Formats of the same codec (e.g. H.264 profiles) keep their relative order.
+std::vector<webrtc::SdpVideoFormat> Prefer(
+    std::vector<webrtc::SdpVideoFormat> formats,
+    const VideoCodecPreferences& preferences) {
+  std::vector<std::pair<size_t, webrtc::SdpVideoFormat>> ranked;
+  ranked.reserve(formats.size());
+  for (auto& format : formats) {
+    size_t rank;
+    if (FindPreference(preferences, format, &rank) == nullptr) {
+      continue;
+    }
+
+    if (!preferences.vp9_svc &&
+        webrtc::PayloadStringToCodecType(format.name) ==
+            webrtc::kVideoCodecVP9) {
+      auto& modes = format.scalability_modes;
+      modes.erase(std::remove_if(modes.begin(), modes.end(), IsSpatial),
+                  modes.end());
+    }
+    ranked.emplace_back(rank, std::move(format));
+  }
+
+  std::stable_sort(
+      ranked.begin(), ranked.end(),
+      [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  std::vector<webrtc::SdpVideoFormat> result;
+  result.reserve(ranked.size());
+  for (auto& format : ranked) {
+    result.push_back(std::move(format.second));
+  }
+  return result;
+}
+
+// `VideoEncoder` overriding the complexity of the wrapped one.
+class ComplexityVideoEncoder : public webrtc::VideoEncoder {
+ public:
+  ComplexityVideoEncoder(std::unique_ptr<webrtc::VideoEncoder> encoder,
+                         webrtc::VideoCodecComplexity complexity)
+      : encoder_(std::move(encoder)), complexity_(complexity) {}
+
+  void SetFecControllerOverride(
+      webrtc::FecControllerOverride* fec_controller_override) override {
+    encoder_->SetFecControllerOverride(fec_controller_override);
+  }
+
+  // Initializes the wrapped encoder with the configured complexity.
+  int InitEncode(const webrtc::VideoCodec* codec_settings,
+                 const Settings& settings) override {
+    if (codec_settings == nullptr) {
+      return encoder_->InitEncode(codec_settings, settings);
+    }
+
+    auto codec = *codec_settings;
+    codec.SetVideoEncoderComplexity(complexity_);
+    return encoder_->InitEncode(&codec, settings);
+  }
+
+  int32_t RegisterEncodeCompleteCallback(
+      webrtc::EncodedImageCallback* callback) override {
+    return encoder_->RegisterEncodeCompleteCallback(callback);
+  }
+
+  int32_t Release() override { return encoder_->Release(); }
+
+  int32_t Encode(
+      const webrtc::VideoFrame& frame,
+      const std::vector<webrtc::VideoFrameType>* frame_types) override {
+    return encoder_->Encode(frame, frame_types);
+  }
+
+  void SetRates(const RateControlParameters& parameters) override {
+    encoder_->SetRates(parameters);
+  }
+
+  void OnPacketLossRateUpdate(float packet_loss_rate) override {
+    encoder_->OnPacketLossRateUpdate(packet_loss_rate);
+  }
+
+  void OnRttUpdate(int64_t rtt_ms) override { encoder_->OnRttUpdate(rtt_ms); }
+
+  void OnLossNotification(const LossNotification& loss_notification) override {
+    encoder_->OnLossNotification(loss_notification);
+  }
+
+  EncoderInfo GetEncoderInfo() const override {
+    return encoder_->GetEncoderInfo();
+  }
+
+ private:
+  // Wrapped `VideoEncoder`.
+  std::unique_ptr<webrtc::VideoEncoder> encoder_;
+
+  // Complexity the wrapped encoder is initialized with.
+  const webrtc::VideoCodecComplexity complexity_;
+};
+
+}  // namespace
+
+PreferredVideoEncoderFactory::PreferredVideoEncoderFactory(
+    std::unique_ptr<webrtc::VideoEncoderFactory> factory,
+    VideoCodecPreferences preferences)
+    : factory_(std::move(factory)), preferences_(std::move(preferences)) {}
+
+// Returns the supported formats of the enabled codecs in their preference
+// order.
+std::vector<webrtc::SdpVideoFormat>
+PreferredVideoEncoderFactory::GetSupportedFormats() const {
+  return Prefer(factory_->GetSupportedFormats(), preferences_);
+}
+
+// Reports the disabled codecs as unsupported.
+webrtc::VideoEncoderFactory::CodecSupport
+PreferredVideoEncoderFactory::QueryCodecSupport(
+    const webrtc::SdpVideoFormat& format,
+    absl::optional<std::string> scalability_mode) const {
+  if (FindPreference(preferences_, format, nullptr) == nullptr) {
+    return CodecSupport{};
+  }
+
+  if (!preferences_.vp9_svc && scalability_mode &&
+      webrtc::PayloadStringToCodecType(format.name) == webrtc::kVideoCodecVP9) {
+    const auto mode = webrtc::ScalabilityModeFromString(*scalability_mode);
+    if (mode && IsSpatial(*mode)) {
+      return CodecSupport{};
+    }
+  }
+
+  return factory_->QueryCodecSupport(format, std::move(scalability_mode));
+}
+
+// Creates a new encoder of the provided `format`, applying its configured
+// complexity, or returns `nullptr` if its codec is disabled.
+std::unique_ptr<webrtc::VideoEncoder>
+PreferredVideoEncoderFactory::CreateVideoEncoder(
+    const webrtc::SdpVideoFormat& format) {
+  const auto* preference = FindPreference(preferences_, format, nullptr);
+  if (preference == nullptr) {
+    return nullptr;
+  }
+
+  auto encoder = factory_->CreateVideoEncoder(format);
+  if (encoder == nullptr ||
+      preference->complexity ==
+          webrtc::VideoCodecComplexity::kComplexityNormal) {
+    return encoder;
+  }
+  return std::make_unique<ComplexityVideoEncoder>(std::move(encoder),
+                                                  preference->complexity);
+}
+
+// Returns the `EncoderSelectorInterface` of the wrapped factory.
+std::unique_ptr<webrtc::VideoEncoderFactory::EncoderSelectorInterface>
+PreferredVideoEncoderFactory::GetEncoderSelector() const {
+  return factory_->GetEncoderSelector();
+}
+
+PreferredVideoDecoderFactory::PreferredVideoDecoderFactory(
+    std::unique_ptr<webrtc::VideoDecoderFactory> factory,
+    VideoCodecPreferences preferences)
+    : factory_(std::move(factory)), preferences_(std::move(preferences)) {}
+
+// Returns the supported formats of the enabled codecs in their preference
+// order.
+std::vector<webrtc::SdpVideoFormat>
+PreferredVideoDecoderFactory::GetSupportedFormats() const {
+  return Prefer(factory_->GetSupportedFormats(), preferences_);
+}
+
+// Reports the disabled codecs as unsupported.
+webrtc::VideoDecoderFactory::CodecSupport
+PreferredVideoDecoderFactory::QueryCodecSupport(
+    const webrtc::SdpVideoFormat& format,
+    bool reference_scaling) const {
+  if (FindPreference(preferences_, format, nullptr) == nullptr) {
+    return CodecSupport{};
+  }
+  return factory_->QueryCodecSupport(format, reference_scaling);
+}
+
+// Creates a new decoder of the provided `format`, or returns `nullptr` if its
+// codec is disabled.
+std::unique_ptr<webrtc::VideoDecoder>
+PreferredVideoDecoderFactory::CreateVideoDecoder(
+    const webrtc::SdpVideoFormat& format) {
+  if (FindPreference(preferences_, format, nullptr) == nullptr) {
+    return nullptr;
+  }
+  return factory_->CreateVideoDecoder(format);
+}
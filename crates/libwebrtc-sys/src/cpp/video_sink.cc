@@ -9,9 +9,11 @@ ForwardingVideoSink::ForwardingVideoSink(
     rust::Box<bridge::DynOnFrameCallback> cb_) : cb_(std::move(cb_)) {}
 
 // Propagates the received `VideoFrame` to the Rust side.
+//
+// The `VideoFrame` is lent by reference, so the Rust side decides whether (and
+// where) to retain it, without any allocation happening here.
 void ForwardingVideoSink::OnFrame(const webrtc::VideoFrame& video_frame) {
-  bridge::on_frame(*cb_.value(),
-                   std::make_unique<webrtc::VideoFrame>(video_frame));
+  bridge::on_frame(*cb_.value(), video_frame);
 }
 
 }  // namespace video_sink
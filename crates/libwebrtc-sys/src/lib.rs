@@ -3,7 +3,12 @@
 
 mod bridge;
 
-use std::{collections::HashMap, mem};
+use std::{
+    collections::HashMap,
+    mem,
+    ops::{BitOr, Deref},
+    sync::{Arc, Mutex, Weak},
+};
 
 use anyhow::{anyhow, bail};
 use cxx::{let_cxx_string, CxxString, CxxVector, UniquePtr};
@@ -12,13 +17,18 @@ use derive_more::From;
 use self::bridge::webrtc;
 
 pub use crate::webrtc::{
-    candidate_to_string, get_candidate_pair,
-    get_estimated_disconnected_time_ms, get_last_data_received_ms, get_reason,
-    video_frame_to_abgr, video_frame_to_argb, AudioLayer, BundlePolicy,
-    Candidate, CandidatePairChangeEvent, CandidateType, IceConnectionState,
-    IceGatheringState, IceTransportsType, MediaType, PeerConnectionState,
-    RTCStatsIceCandidatePairState, RtpTransceiverDirection, SdpType,
-    SignalingState, TrackState, VideoFrame, VideoRotation,
+    candidate_to_string, disable_audio_device_cache, enable_audio_device_cache,
+    get_candidate_pair, get_estimated_disconnected_time_ms,
+    get_last_data_received_ms, get_reason, i420_buffer_pool_stats,
+    invalidate_audio_device_cache, set_i420_buffer_pool_depth,
+    video_frame_to_abgr, video_frame_to_abgr_scaled, video_frame_to_argb,
+    AudioCaptureFormat, AudioLayer, AudioProcessingOptions, AudioSampleFormat,
+    BundlePolicy, Candidate, CandidatePairChangeEvent, CandidateType,
+    FakeAudioOptions, FakeAudioSignal, FakeVideoContent, I420BufferPoolStats,
+    IceConnectionState, IceGatheringState, IceTransportsType, MediaType,
+    PeerConnectionState, RTCStatsColumn, RTCStatsIceCandidatePairState,
+    RTCStatsType, RtpTransceiverDirection, SdpType, SignalingState, TrackState,
+    VideoFrame, VideoRotation, VideoSinkWants,
 };
 
 /// Handler of events firing from a [`MediaStreamTrackInterface`].
@@ -57,7 +67,10 @@ pub trait SetDescriptionCallback {
 pub trait OnFrameCallback {
     /// Called when the attached [`VideoTrackInterface`] produces a new
     /// [`VideoFrame`].
-    fn on_frame(&mut self, frame: UniquePtr<VideoFrame>);
+    ///
+    /// The provided [`VideoFrame`] is only borrowed for the duration of this
+    /// call, use a [`VideoFramePool`] to retain it.
+    fn on_frame(&mut self, frame: &VideoFrame);
 }
 
 /// Handler of [`RtcStatsReport`]s.
@@ -175,6 +188,15 @@ pub trait AddIceCandidateCallback {
     fn on_fail(&mut self, error: &CxxString);
 }
 
+/// Completion callback for the asynchronous [`AudioDeviceModule`] calls.
+///
+/// Called on the thread of the [`AudioDeviceModule`].
+pub trait AudioDeviceModuleCallback: Send {
+    /// Called when the call completes with the provided `result` code, being
+    /// `0` on success.
+    fn on_done(&mut self, result: i32);
+}
+
 /// Thread safe task queue factory internally used in [`WebRTC`] that is capable
 /// of creating [Task Queue]s.
 ///
@@ -290,28 +312,39 @@ impl AudioDeviceModule {
         Ok((name, guid))
     }
 
-    /// Creates a new fake [`AudioSourceInterface`].
+    /// Creates a new fake [`AudioSourceInterface`] producing the signal of
+    /// the provided [`FakeAudioOptions`].
     pub fn create_fake_audio_source(
         &self,
+        options: &FakeAudioOptions,
     ) -> anyhow::Result<AudioSourceInterface> {
-        let ptr = webrtc::create_fake_audio_source();
+        let ptr = webrtc::create_fake_audio_source(options);
 
         if ptr.is_null() {
             bail!(
                 "`null` pointer returned from \
-                 `webrtc::PeerConnectionFactoryInterface\
-                  ::CreateFakeAudioSource()`",
+                 `webrtc::create_fake_audio_source()`",
             );
         }
         Ok(AudioSourceInterface(ptr))
     }
 
-    /// Creates a new [`AudioSourceInterface`].
+    /// Creates a new [`AudioSourceInterface`] recording the device with the
+    /// provided `device_index` in the provided [`AudioCaptureFormat`], and
+    /// processing the recorded audio according to the provided
+    /// [`AudioProcessingOptions`].
     pub fn create_audio_source(
         &self,
         device_index: u16,
+        format: AudioCaptureFormat,
+        processing: AudioProcessingOptions,
     ) -> anyhow::Result<AudioSourceInterface> {
-        let ptr = webrtc::create_audio_source(&self.0, device_index);
+        let ptr = webrtc::create_audio_source(
+            &self.0,
+            device_index,
+            format,
+            processing,
+        );
 
         if ptr.is_null() {
             bail!(
@@ -341,6 +374,34 @@ impl AudioDeviceModule {
         Ok(())
     }
 
+    /// Sets the number of 10 ms buffers kept queued for playout, trading the
+    /// playout latency against the risk of underruns.
+    ///
+    /// Restarts the playout if it's active already.
+    pub fn set_playout_buffer_depth(&self, buffers: u16) -> anyhow::Result<()> {
+        let result = webrtc::set_playout_buffer_depth(&self.0, buffers);
+
+        if result != 0 {
+            bail!(
+                "`AudioDeviceModule::SetPlayoutBufferDepth()` failed with \
+                 `{result}` code",
+            );
+        }
+
+        Ok(())
+    }
+
+    /// Asynchronously sets the playout device by its `index`, passing the
+    /// result to the provided [`AudioDeviceModuleCallback`] instead of
+    /// blocking on the [`AudioDeviceModule`] thread.
+    pub fn set_playout_device_async(
+        &self,
+        index: u16,
+        cb: Box<dyn AudioDeviceModuleCallback>,
+    ) {
+        webrtc::set_audio_playout_device_async(&self.0, index, Box::new(cb));
+    }
+
     /// Stops playout of audio on this device.
     pub fn stop_playout(&self) -> anyhow::Result<()> {
         let result = webrtc::stop_playout(&self.0);
@@ -426,6 +487,16 @@ impl AudioDeviceModule {
         Ok(())
     }
 
+    /// Asynchronously sets the microphone volume level, passing the result to
+    /// the provided [`AudioDeviceModuleCallback`].
+    pub fn set_microphone_volume_async(
+        &self,
+        volume: u32,
+        cb: Box<dyn AudioDeviceModuleCallback>,
+    ) {
+        webrtc::set_microphone_volume_async(&self.0, volume, Box::new(cb));
+    }
+
     /// Indicates whether the microphone is available to set volume.
     pub fn microphone_volume_is_available(&self) -> anyhow::Result<bool> {
         let mut is_available = false;
@@ -1518,6 +1589,27 @@ impl PeerConnectionInterface {
     pub fn get_stats(&self, cb: Box<dyn RTCStatsCollectorCallback>) {
         webrtc::peer_connection_get_stats(&self.inner, Box::new(cb));
     }
+
+    /// Loads an [`RtcStatsReport`] of the senders and receivers of the tracks
+    /// and transceivers (by their `mid`s) with the provided `ids` only.
+    ///
+    /// The resulting report is empty if none of them are found. Stats of the
+    /// types not in the provided [`RtcStatsTypes`] are skipped before being
+    /// copied, unless a single sender or receiver is found, whose report is
+    /// loaded as is.
+    pub fn get_selected_stats(
+        &self,
+        ids: Vec<String>,
+        types: RtcStatsTypes,
+        cb: Box<dyn RTCStatsCollectorCallback>,
+    ) {
+        webrtc::peer_connection_get_selected_stats(
+            &self.inner,
+            &ids,
+            types.bits(),
+            Box::new(cb),
+        );
+    }
 }
 
 /// Interface for using an RTC [`Thread`][1].
@@ -1566,13 +1658,15 @@ pub struct PeerConnectionFactoryInterface(
 );
 
 impl PeerConnectionFactoryInterface {
-    /// Creates a new [`PeerConnectionFactoryInterface`].
+    /// Creates a new [`PeerConnectionFactoryInterface`] encoding and decoding
+    /// the video codecs of the provided [`VideoCodecConfig`] only.
     pub fn create(
         network_thread: Option<&Thread>,
         worker_thread: Option<&Thread>,
         signaling_thread: Option<&Thread>,
         default_adm: Option<&AudioDeviceModule>,
         ap: Option<&AudioProcessing>,
+        video_codecs: &VideoCodecConfig,
     ) -> anyhow::Result<Self> {
         let inner = webrtc::create_peer_connection_factory(
             network_thread.map_or(&UniquePtr::null(), |t| &t.0),
@@ -1580,6 +1674,7 @@ impl PeerConnectionFactoryInterface {
             signaling_thread.map_or(&UniquePtr::null(), |t| &t.0),
             default_adm.map_or(&UniquePtr::null(), |t| &t.0),
             ap.map_or(&UniquePtr::null(), |ap| &ap.0),
+            video_codecs,
         );
 
         if inner.is_null() {
@@ -1727,13 +1822,17 @@ impl VideoTrackSourceInterface {
         Ok(VideoTrackSourceInterface(ptr))
     }
 
-    /// Creates a new fake [`VideoTrackSourceInterface`].
+    /// Creates a new fake [`VideoTrackSourceInterface`] producing frames of
+    /// the provided [`FakeVideoContent`], optionally overlaid with their
+    /// number and capture time.
     pub fn create_fake(
         worker_thread: &mut Thread,
         signaling_thread: &mut Thread,
         width: usize,
         height: usize,
         fps: usize,
+        content: FakeVideoContent,
+        counter_overlay: bool,
     ) -> anyhow::Result<Self> {
         let ptr = webrtc::create_fake_device_video_source(
             worker_thread.0.pin_mut(),
@@ -1741,6 +1840,8 @@ impl VideoTrackSourceInterface {
             width,
             height,
             fps,
+            content,
+            counter_overlay,
         );
 
         if ptr.is_null() {
@@ -1755,6 +1856,9 @@ impl VideoTrackSourceInterface {
     /// Starts screen capturing and creates a new [`VideoTrackSourceInterface`]
     /// with the specified constraints.
     ///
+    /// Capturing adapts its framerate to spend at most
+    /// `cpu_budget_percentage` of a single CPU core.
+    ///
     /// The created capturer is wrapped in the `VideoTrackSourceProxy` that
     /// makes sure the real [`VideoTrackSourceInterface`] implementation is
     /// destroyed on the signaling thread and marshals all method calls to the
@@ -1766,6 +1870,7 @@ impl VideoTrackSourceInterface {
         width: usize,
         height: usize,
         fps: usize,
+        cpu_budget_percentage: u8,
     ) -> anyhow::Result<Self> {
         let ptr = webrtc::create_display_video_source(
             worker_thread.0.pin_mut(),
@@ -1774,6 +1879,7 @@ impl VideoTrackSourceInterface {
             width,
             height,
             fps,
+            cpu_budget_percentage,
         );
 
         if ptr.is_null() {
@@ -1881,12 +1987,17 @@ pub struct VideoTrackInterface {
 
 impl VideoTrackInterface {
     /// Register the provided [`VideoSinkInterface`] for this
-    /// [`VideoTrackInterface`].
+    /// [`VideoTrackInterface`] with the provided [`VideoSinkWants`], or
+    /// updates its [`VideoSinkWants`] if it's registered already.
     ///
     /// Used to connect this [`VideoTrackInterface`] to the underlying video
     /// engine.
-    pub fn add_or_update_sink(&self, sink: &mut VideoSinkInterface) {
-        webrtc::add_or_update_video_sink(&self.inner, sink.0.pin_mut());
+    pub fn add_or_update_sink(
+        &self,
+        sink: &mut VideoSinkInterface,
+        wants: &VideoSinkWants,
+    ) {
+        webrtc::add_or_update_video_sink(&self.inner, sink.0.pin_mut(), wants);
     }
 
     /// Detaches the provided [`VideoSinkInterface`] from this
@@ -2124,6 +2235,162 @@ impl VideoSinkInterface {
 unsafe impl Send for webrtc::VideoSinkInterface {}
 unsafe impl Sync for webrtc::VideoSinkInterface {}
 
+impl Default for AudioCaptureFormat {
+    /// Returns the [`AudioCaptureFormat`] of 48 kHz mono 16-bit samples with a
+    /// one second capture ring.
+    fn default() -> Self {
+        Self {
+            sample_rate: 48000,
+            channels: 1,
+            sample_format: AudioSampleFormat::Int16,
+            ring_size_ms: 1000,
+        }
+    }
+}
+
+impl Default for AudioProcessingOptions {
+    /// Returns the [`AudioProcessingOptions`] enabling all the audio
+    /// processing.
+    fn default() -> Self {
+        Self {
+            echo_cancellation: true,
+            noise_suppression: true,
+            auto_gain_control: true,
+            high_pass_filter: true,
+        }
+    }
+}
+
+impl Default for FakeAudioOptions {
+    /// Returns the [`FakeAudioOptions`] of silence without markers.
+    fn default() -> Self {
+        Self {
+            signal: FakeAudioSignal::Silence,
+            frequency_hz: 440,
+            wav_path: String::new(),
+            marker_interval_ms: 0,
+        }
+    }
+}
+
+impl Default for VideoCodecConfig {
+    /// Returns the [`VideoCodecConfig`] enabling all the [`VideoCodecKind`]s
+    /// with their default complexity, preferring VP8, then VP9, H.264 and AV1.
+    fn default() -> Self {
+        let codecs = [
+            VideoCodecKind::VP8,
+            VideoCodecKind::VP9,
+            VideoCodecKind::H264,
+            VideoCodecKind::AV1,
+        ]
+        .into_iter()
+        .map(|kind| VideoCodecSettings {
+            kind,
+            complexity: VideoEncoderComplexity::Normal,
+        })
+        .collect();
+
+        Self {
+            codecs,
+            vp9_svc: true,
+        }
+    }
+}
+
+impl Default for VideoSinkWants {
+    /// Returns unconstrained [`VideoSinkWants`], same as the default
+    /// `rtc::VideoSinkWants`.
+    fn default() -> Self {
+        Self {
+            max_pixel_count: i32::MAX,
+            max_framerate_fps: i32::MAX,
+            resolution_alignment: 1,
+        }
+    }
+}
+
+/// Maximum number of idle [`VideoFrame`] allocations kept by a
+/// [`VideoFramePool`].
+const VIDEO_FRAME_POOL_CAPACITY: usize = 4;
+
+/// Idle [`VideoFrame`] allocations of a [`VideoFramePool`].
+type VideoFrameSlots = Mutex<Vec<UniquePtr<VideoFrame>>>;
+
+/// Pool of reusable [`VideoFrame`] allocations.
+///
+/// [`PooledVideoFrame`]s acquired from this pool share the pixel buffer of the
+/// source [`VideoFrame`] (only its reference counter is bumped) and return
+/// their allocation back to this pool once dropped, so retaining a
+/// [`VideoFrame`] requires neither a pixel copy nor a heap allocation in the
+/// steady state.
+#[derive(Clone, Default)]
+pub struct VideoFramePool(Arc<VideoFrameSlots>);
+
+impl VideoFramePool {
+    /// Creates a new empty [`VideoFramePool`].
+    #[must_use]
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Returns a [`PooledVideoFrame`] sharing the pixel buffer of the provided
+    /// [`VideoFrame`].
+    #[must_use]
+    pub fn acquire(&self, src: &VideoFrame) -> PooledVideoFrame {
+        let idle = self.0.lock().unwrap().pop();
+        let frame = if let Some(mut frame) = idle {
+            webrtc::assign_video_frame(frame.pin_mut(), src);
+            frame
+        } else {
+            webrtc::clone_video_frame(src)
+        };
+
+        PooledVideoFrame {
+            frame: Some(frame),
+            pool: Arc::downgrade(&self.0),
+        }
+    }
+}
+
+/// [`VideoFrame`] retained from a [`VideoFramePool`].
+///
+/// Releases its pixel buffer and returns its allocation back to the
+/// [`VideoFramePool`] once dropped.
+pub struct PooledVideoFrame {
+    /// Underlying [`VideoFrame`].
+    ///
+    /// Always [`Some`] until this [`PooledVideoFrame`] is dropped.
+    frame: Option<UniquePtr<VideoFrame>>,
+
+    /// [`VideoFramePool`] this [`PooledVideoFrame`] belongs to.
+    pool: Weak<VideoFrameSlots>,
+}
+
+impl Deref for PooledVideoFrame {
+    type Target = VideoFrame;
+
+    fn deref(&self) -> &Self::Target {
+        self.frame.as_deref().unwrap()
+    }
+}
+
+impl Drop for PooledVideoFrame {
+    fn drop(&mut self) {
+        if let (Some(mut frame), Some(pool)) =
+            (self.frame.take(), self.pool.upgrade())
+        {
+            let mut idle = pool.lock().unwrap();
+            if idle.len() < VIDEO_FRAME_POOL_CAPACITY {
+                webrtc::release_video_frame_buffer(frame.pin_mut());
+                idle.push(frame);
+            }
+        }
+    }
+}
+
+unsafe impl Send for webrtc::VideoFrame {}
+unsafe impl Sync for webrtc::VideoFrame {}
+
 /// Fields of [`RtcStatsType::RtcMediaSourceStats`] variant.
 pub enum RtcMediaSourceStatsMediaType {
     /// Video source fields.
@@ -3038,6 +3305,77 @@ impl TryFrom<webrtc::RTCStatsWrap> for RtcStats {
     }
 }
 
+/// Set of [`RtcStatsType`]s to load from an [`RtcStatsReport`].
+#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+pub struct RtcStatsTypes(u32);
+
+impl RtcStatsTypes {
+    /// [`RtcStatsType::RtcMediaSourceStats`].
+    pub const MEDIA_SOURCE: Self =
+        Self::of(webrtc::RTCStatsType::RTCMediaSourceStats);
+
+    /// [`RtcStatsType::RtcIceCandidateStats`].
+    pub const ICE_CANDIDATE: Self =
+        Self::of(webrtc::RTCStatsType::RTCIceCandidateStats);
+
+    /// [`RtcStatsType::RtcOutboundRtpStreamStats`].
+    pub const OUTBOUND_RTP: Self =
+        Self::of(webrtc::RTCStatsType::RTCOutboundRTPStreamStats);
+
+    /// [`RtcStatsType::RtcInboundRtpStreamStats`].
+    pub const INBOUND_RTP: Self =
+        Self::of(webrtc::RTCStatsType::RTCInboundRTPStreamStats);
+
+    /// [`RtcStatsType::RtcIceCandidatePairStats`].
+    pub const ICE_CANDIDATE_PAIR: Self =
+        Self::of(webrtc::RTCStatsType::RTCIceCandidatePairStats);
+
+    /// [`RtcStatsType::RtcTransportStats`].
+    pub const TRANSPORT: Self =
+        Self::of(webrtc::RTCStatsType::RTCTransportStats);
+
+    /// [`RtcStatsType::RtcRemoteInboundRtpStreamStats`].
+    pub const REMOTE_INBOUND_RTP: Self =
+        Self::of(webrtc::RTCStatsType::RTCRemoteInboundRtpStreamStats);
+
+    /// [`RtcStatsType::RtcRemoteOutboundRtpStreamStats`].
+    pub const REMOTE_OUTBOUND_RTP: Self =
+        Self::of(webrtc::RTCStatsType::RTCRemoteOutboundRtpStreamStats);
+
+    /// [`RtcStatsType::Unimplemented`].
+    pub const UNIMPLEMENTED: Self =
+        Self::of(webrtc::RTCStatsType::Unimplemented);
+
+    /// All the [`RtcStatsType`]s.
+    pub const ALL: Self = Self(u32::MAX);
+
+    /// Creates [`RtcStatsTypes`] from the provided bits, where the bit `n`
+    /// stands for the [`RtcStatsType`] variant with index `n`.
+    #[must_use]
+    pub const fn from_bits(bits: u32) -> Self {
+        Self(bits)
+    }
+
+    /// Returns the bits of these [`RtcStatsTypes`].
+    #[must_use]
+    pub const fn bits(self) -> u32 {
+        self.0
+    }
+
+    /// Returns [`RtcStatsTypes`] containing the provided type only.
+    const fn of(kind: webrtc::RTCStatsType) -> Self {
+        Self(1 << kind.repr)
+    }
+}
+
+impl BitOr for RtcStatsTypes {
+    type Output = Self;
+
+    fn bitor(self, rhs: Self) -> Self {
+        Self(self.0 | rhs.0)
+    }
+}
+
 /// Collection of [`RtcStats`].
 #[derive(From)]
 pub struct RtcStatsReport(UniquePtr<webrtc::RTCStatsReport>);
@@ -3045,9 +3383,128 @@ pub struct RtcStatsReport(UniquePtr<webrtc::RTCStatsReport>);
 impl RtcStatsReport {
     /// Loads current [`RtcStats`].
     pub fn get_stats(&self) -> anyhow::Result<Vec<RtcStats>> {
-        webrtc::rtc_stats_report_get_stats(&self.0)
+        self.get_filtered_stats(RtcStatsTypes::ALL)
+    }
+
+    /// Loads current [`RtcStats`] of the provided [`RtcStatsTypes`] only.
+    ///
+    /// Stats of other types are skipped before being copied out of the
+    /// report.
+    pub fn get_filtered_stats(
+        &self,
+        types: RtcStatsTypes,
+    ) -> anyhow::Result<Vec<RtcStats>> {
+        webrtc::rtc_stats_report_get_stats(&self.0, types.bits())
+            .into_iter()
+            .map(RtcStats::try_from)
+            .collect()
+    }
+
+    /// Loads current [`RtcStats`] with the provided `ids` only, skipping the
+    /// ones missing in the report.
+    ///
+    /// Only the requested [`RtcStats`] are copied out of the report.
+    pub fn get_stats_by_ids(
+        &self,
+        ids: &[String],
+    ) -> anyhow::Result<Vec<RtcStats>> {
+        webrtc::rtc_stats_report_get_stats_by_ids(&self.0, ids)
             .into_iter()
             .map(RtcStats::try_from)
             .collect()
     }
+
+    /// Loads current stats of the provided [`RtcStatsTypes`] as
+    /// [`RtcStatsColumns`].
+    ///
+    /// Unlike [`RtcStatsReport::get_filtered_stats()`], this doesn't copy and
+    /// cast every [`RtcStats`] separately, but transfers all of them at once.
+    #[must_use]
+    pub fn get_columns(&self, types: RtcStatsTypes) -> RtcStatsColumns {
+        RtcStatsColumns(webrtc::rtc_stats_report_get_columns(
+            &self.0,
+            types.bits(),
+        ))
+    }
+}
+
+/// Columnar snapshot of an [`RtcStatsReport`].
+///
+/// Holds a row per [`RtcStats`] and a fixed set of [`RTCStatsColumn`]s, so the
+/// same metrics of all the rows are laid out contiguously.
+pub struct RtcStatsColumns(webrtc::RTCStatsColumns);
+
+impl RtcStatsColumns {
+    /// Returns the number of rows in these [`RtcStatsColumns`].
+    #[must_use]
+    pub fn len(&self) -> usize {
+        self.0.rows
+    }
+
+    /// Indicates whether these [`RtcStatsColumns`] have no rows.
+    #[must_use]
+    pub fn is_empty(&self) -> bool {
+        self.0.rows == 0
+    }
+
+    /// Returns the [`RTCStatsType`] of the provided `row`.
+    ///
+    /// # Panics
+    ///
+    /// If the `row` is out of bounds.
+    #[must_use]
+    pub fn kind(&self, row: usize) -> RTCStatsType {
+        RTCStatsType {
+            repr: self.0.kinds[row],
+        }
+    }
+
+    /// Returns the ID of the provided `row`.
+    ///
+    /// # Panics
+    ///
+    /// If the `row` is out of bounds.
+    #[must_use]
+    pub fn id(&self, row: usize) -> &str {
+        &self.0.strings[self.0.ids[row] as usize]
+    }
+
+    /// Returns the timestamp of the provided `row` in microseconds.
+    ///
+    /// # Panics
+    ///
+    /// If the `row` is out of bounds.
+    #[must_use]
+    pub fn timestamp_us(&self, row: usize) -> i64 {
+        self.0.timestamps_us[row]
+    }
+
+    /// Returns the numeric value of the provided `column` of the `row`, if
+    /// it's present.
+    ///
+    /// Values of the string [`RTCStatsColumn`]s are indices of their strings,
+    /// so [`RtcStatsColumns::string()`] should be used for them instead.
+    #[must_use]
+    pub fn value(&self, row: usize, column: RTCStatsColumn) -> Option<f64> {
+        if row >= self.0.rows {
+            return None;
+        }
+
+        let index = usize::from(column.repr) * self.0.rows + row;
+        let present = (self.0.presence[index / 64] >> (index % 64)) & 1 == 1;
+        present.then(|| self.0.values[index])
+    }
+
+    /// Returns the string value of the provided `column` of the `row`, if it's
+    /// present and the `column` is a string one.
+    #[allow(clippy::cast_possible_truncation, clippy::cast_sign_loss)]
+    #[must_use]
+    pub fn string(&self, row: usize, column: RTCStatsColumn) -> Option<&str> {
+        if column.repr < RTCStatsColumn::Kind.repr {
+            return None;
+        }
+
+        self.value(row, column)
+            .map(|index| self.0.strings[index as usize].as_str())
+    }
 }
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Maximum number of idle buffers kept for each resolution.
+constexpr size_t kMaxIdleBuffersPerResolution = 8;
+
+class AbgrBufferPool;
+
+// `ABGR` pixel buffer of a fixed resolution, returned back to its
+// `AbgrBufferPool` once destroyed.
+class AbgrBuffer {
+ public:
+  AbgrBuffer() = default;
+
+  AbgrBuffer(AbgrBuffer&& other) noexcept { *this = std::move(other); }
+
+  AbgrBuffer& operator=(AbgrBuffer&& other) noexcept;
+
+  AbgrBuffer(const AbgrBuffer&) = delete;
+  AbgrBuffer& operator=(const AbgrBuffer&) = delete;
+
+  ~AbgrBuffer();
+
+  // Returns the pixel data of this buffer.
+  uint8_t* data() const { return data_.get(); }
+
+  // Returns the width of this buffer.
+  uint32_t width() const { return width_; }
+
+  // Returns the height of this buffer.
+  uint32_t height() const { return height_; }
+
+  // Returns the size of this buffer in bytes.
+  size_t size() const { return (size_t)width_ * height_ * 4; }
+
+ private:
+  friend class AbgrBufferPool;
+
+  // Creates a new `AbgrBuffer` owning the provided `data`.
+  AbgrBuffer(AbgrBufferPool* pool,
+             std::unique_ptr<uint8_t[]> data,
+             uint32_t width,
+             uint32_t height)
+      : pool_(pool), data_(std::move(data)), width_(width), height_(height) {}
+
+  // Pool this buffer is returned to.
+  AbgrBufferPool* pool_ = nullptr;
+
+  // Pixel data of this buffer.
+  std::unique_ptr<uint8_t[]> data_;
+
+  // Width of this buffer.
+  uint32_t width_ = 0;
+
+  // Height of this buffer.
+  uint32_t height_ = 0;
+};
+
+// Memory accounting of an `AbgrBufferPool`.
+struct AbgrBufferPoolStats {
+  // Bytes of all the buffers allocated by the pool, either in use or idle.
+  uint64_t allocated_bytes = 0;
+
+  // Highest value `allocated_bytes` has ever reached.
+  uint64_t high_water_bytes = 0;
+
+  // Bytes of the idle buffers waiting to be reused.
+  uint64_t idle_bytes = 0;
+
+  // Number of the buffers allocated by the pool.
+  uint64_t allocations = 0;
+
+  // Number of the buffers served by reusing idle ones.
+  uint64_t reuses = 0;
+};
+
+// Pool of `AbgrBuffer`s keyed by resolution, shared between all the video
+// textures.
+class AbgrBufferPool {
+ public:
+  // Returns the `AbgrBufferPool` shared between all the video textures.
+  static AbgrBufferPool& Shared() {
+    // Intentionally leaked, so buffers may be returned at any point of the
+    // program shutdown.
+    static AbgrBufferPool* pool = new AbgrBufferPool();
+    return *pool;
+  }
+
+  // Returns an `AbgrBuffer` of the provided resolution, reusing an idle one if
+  // any.
+  AbgrBuffer Acquire(uint32_t width, uint32_t height) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = idle_.find({width, height});
+    if (it != idle_.end() && !it->second.empty()) {
+      std::unique_ptr<uint8_t[]> data = std::move(it->second.back());
+      it->second.pop_back();
+      stats_.idle_bytes -= (uint64_t)width * height * 4;
+      stats_.reuses++;
+      return AbgrBuffer(this, std::move(data), width, height);
+    }
+
+    uint64_t size = (uint64_t)width * height * 4;
+    stats_.allocated_bytes += size;
+    stats_.allocations++;
+    if (stats_.allocated_bytes > stats_.high_water_bytes) {
+      stats_.high_water_bytes = stats_.allocated_bytes;
+    }
+    return AbgrBuffer(this, std::make_unique<uint8_t[]>(size), width, height);
+  }
+
+  // Returns a snapshot of this pool's memory accounting.
+  AbgrBufferPoolStats stats() {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  friend class AbgrBuffer;
+
+  AbgrBufferPool() = default;
+
+  // Takes the provided buffer data back, freeing it if there are too many idle
+  // buffers of the same resolution already.
+  void Release(std::unique_ptr<uint8_t[]> data,
+               uint32_t width,
+               uint32_t height) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    uint64_t size = (uint64_t)width * height * 4;
+    auto& idle = idle_[{width, height}];
+    if (idle.size() < kMaxIdleBuffersPerResolution) {
+      idle.push_back(std::move(data));
+      stats_.idle_bytes += size;
+    } else {
+      stats_.allocated_bytes -= size;
+    }
+  }
+
+  // Mutex guarding all the fields of this pool.
+  std::mutex mutex_;
+
+  // Idle buffers grouped by their width and height.
+  std::map<std::pair<uint32_t, uint32_t>,
+           std::vector<std::unique_ptr<uint8_t[]>>>
+      idle_;
+
+  // Memory accounting of this pool.
+  AbgrBufferPoolStats stats_;
+};
+
+// Returns this buffer to its pool (if any) and takes the `other` one.
+inline AbgrBuffer& AbgrBuffer::operator=(AbgrBuffer&& other) noexcept {
+  if (this != &other) {
+    if (pool_ != nullptr && data_ != nullptr) {
+      pool_->Release(std::move(data_), width_, height_);
+    }
+    pool_ = std::exchange(other.pool_, nullptr);
+    data_ = std::move(other.data_);
+    width_ = std::exchange(other.width_, 0);
+    height_ = std::exchange(other.height_, 0);
+  }
+  return *this;
+}
+
+// Returns this buffer to its pool (if any).
+inline AbgrBuffer::~AbgrBuffer() {
+  if (pool_ != nullptr && data_ != nullptr) {
+    pool_->Release(std::move(data_), width_, height_);
+  }
+}
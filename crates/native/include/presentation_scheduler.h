@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+// Refresh rate assumed when the display one cannot be determined.
+constexpr double kDefaultRefreshRateHz = 60.0;
+
+// Scheduler coalescing "frame available" notifications of video textures.
+//
+// Textures are marked dirty whenever a new frame is produced for them, and all
+// the dirty textures are notified at once, at most once per display refresh.
+// So the notifications rate is capped by the refresh rate, regardless of the
+// number of active streams and their framerate.
+class PresentationScheduler {
+ public:
+  // Callback notifying the texture with the provided ID about a new frame.
+  using NotifyFn = std::function<void(int64_t)>;
+
+  // Creates a new `PresentationScheduler` notifying textures via the provided
+  // `notify` callback at most `refresh_rate_hz` times per second.
+  PresentationScheduler(double refresh_rate_hz, NotifyFn notify)
+      : refresh_interval_(RefreshInterval(refresh_rate_hz)),
+        notify_(std::move(notify)),
+        thread_([this] { Run(); }) {}
+
+  PresentationScheduler(const PresentationScheduler&) = delete;
+  PresentationScheduler& operator=(const PresentationScheduler&) = delete;
+
+  ~PresentationScheduler() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+  }
+
+  // Starts accepting frames of the texture with the provided ID.
+  void Register(int64_t texture_id) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    registered_.insert(texture_id);
+  }
+
+  // Stops notifying the texture with the provided ID.
+  //
+  // Once this returns, the texture is guaranteed not to be notified anymore,
+  // so it can be safely unregistered from Flutter.
+  void Unregister(int64_t texture_id) {
+    const std::lock_guard<std::mutex> notify_lock(notify_mutex_);
+    const std::lock_guard<std::mutex> lock(mutex_);
+    registered_.erase(texture_id);
+    dirty_.erase(texture_id);
+  }
+
+  // Marks the texture with the provided ID as having a new frame available.
+  //
+  // Can be called from any thread.
+  void MarkDirty(int64_t texture_id) {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (registered_.count(texture_id) == 0 ||
+          !dirty_.insert(texture_id).second) {
+        return;
+      }
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  using clock = std::chrono::steady_clock;
+
+  // Returns the duration of a single refresh at the provided rate.
+  static clock::duration RefreshInterval(double refresh_rate_hz) {
+    if (refresh_rate_hz <= 0) {
+      refresh_rate_hz = kDefaultRefreshRateHz;
+    }
+    return std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>(1.0 / refresh_rate_hz));
+  }
+
+  // Notifies the dirty textures once per refresh, sleeping while there are
+  // none.
+  void Run() {
+    clock::time_point last_tick;
+    std::vector<int64_t> dirty;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this] { return stopped_ || !dirty_.empty(); });
+      if (stopped_) {
+        return;
+      }
+
+      // Parenthesized to not clash with the `max` macro of `windows.h`.
+      clock::time_point tick =
+          (std::max)(clock::now(), last_tick + refresh_interval_);
+      if (cv_.wait_until(lock, tick, [this] { return stopped_; })) {
+        return;
+      }
+      last_tick = tick;
+
+      dirty.assign(dirty_.begin(), dirty_.end());
+      dirty_.clear();
+      lock.unlock();
+
+      {
+        const std::lock_guard<std::mutex> notify_lock(notify_mutex_);
+        for (int64_t texture_id : dirty) {
+          bool registered;
+          {
+            const std::lock_guard<std::mutex> registered_lock(mutex_);
+            registered = registered_.count(texture_id) != 0;
+          }
+          if (registered) {
+            notify_(texture_id);
+          }
+        }
+      }
+
+      lock.lock();
+    }
+  }
+
+  // Minimal interval between two notifications of the same texture.
+  const clock::duration refresh_interval_;
+
+  // Callback notifying textures about new frames.
+  const NotifyFn notify_;
+
+  // Mutex guarding the `registered_`, `dirty_` and `stopped_` fields.
+  std::mutex mutex_;
+
+  // Mutex held while textures are being notified.
+  std::mutex notify_mutex_;
+
+  // Condition variable waking up the scheduling thread.
+  std::condition_variable cv_;
+
+  // IDs of the textures that may be notified.
+  std::set<int64_t> registered_;
+
+  // IDs of the textures having new frames since the last notification.
+  std::set<int64_t> dirty_;
+
+  // Indicator whether the scheduling thread should stop.
+  bool stopped_ = false;
+
+  // Thread notifying the dirty textures.
+  std::thread thread_;
+};
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "abgr_buffer_pool.h"
+
+// Frame converted by a `RendererCore`.
+struct FrameSlot {
+  // `ABGR` bytes of the frame stored in this slot.
+  //
+  // Kept across frames and only replaced once the resolution changes.
+  AbgrBuffer buffer;
+
+  // Width of the frame stored in this slot.
+  uint32_t width = 0;
+
+  // Height of the frame stored in this slot.
+  uint32_t height = 0;
+};
+
+// Counters of a `RendererCore`.
+struct RendererStats {
+  // Number of frames converted to `ABGR`.
+  uint64_t conversions = 0;
+
+  // Number of times the pixels were pulled by the compositor.
+  uint64_t pulls = 0;
+
+  // Number of frames presented by the compositor.
+  uint64_t presented_frames = 0;
+
+  // Number of frames replaced by newer ones before being presented.
+  uint64_t dropped_frames = 0;
+};
+
+// Platform-neutral core of the video texture renderers, passing frames from
+// the WebRTC thread (producer) to the raster thread (consumer).
+//
+// It's a latest-wins triple buffer: the producer moves each frame into its own
+// back slot and publishes it with a single atomic swap, so it never waits for
+// the raster thread. Frames published while the previous one wasn't acquired
+// yet are dropped without being converted.
+//
+// Frames are converted to `ABGR` lazily, once acquired by the consumer, so
+// neither dropped frames nor the ones of never pulled (e.g. hidden) textures
+// are converted at all. Every published slot is marked as fresh until it's
+// acquired, so pulls happening without any new frame (e.g. when the
+// surrounding UI repaints) just return the already converted `FrameSlot`.
+//
+// `Frame` is expected to have `width` and `height` fields, and a
+// `GetABGRBytes(uint8_t*)` method.
+template <typename Frame>
+class RendererCore {
+ public:
+  // Moves the provided frame into the back slot and publishes it.
+  void Publish(Frame frame) {
+    const std::lock_guard<std::mutex> lock(producer_mutex_);
+
+    slots_[back_] = std::move(frame);
+
+    Swap();
+  }
+
+  // Publishes an empty slot, so nothing is rendered until the next frame.
+  //
+  // The buffer of the converted `FrameSlot` is kept, so it's reused once
+  // frames of the same resolution arrive again.
+  void Clear() {
+    const std::lock_guard<std::mutex> lock(producer_mutex_);
+
+    slots_[back_].reset();
+
+    Swap();
+  }
+
+  // Returns the latest published frame converted to `ABGR`.
+  //
+  // Must only be called from the consumer thread. The returned slot stays
+  // valid until the next call.
+  const FrameSlot& Acquire() {
+    pulls_.fetch_add(1, std::memory_order_relaxed);
+
+    if (!(middle_.load(std::memory_order_relaxed) & kFreshBit)) {
+      return converted_;
+    }
+
+    uint8_t prev = middle_.exchange(front_, std::memory_order_acq_rel);
+    front_ = prev & kIndexMask;
+    presented_frames_.fetch_add(1, std::memory_order_relaxed);
+
+    // The frame is released right away, as it's never acquired again.
+    std::optional<Frame> frame = std::move(slots_[front_]);
+    slots_[front_].reset();
+    if (!frame) {
+      converted_.width = 0;
+      converted_.height = 0;
+      return converted_;
+    }
+
+    uint32_t width = (uint32_t)frame->width;
+    uint32_t height = (uint32_t)frame->height;
+    if (converted_.buffer.width() != width ||
+        converted_.buffer.height() != height) {
+      converted_.buffer = AbgrBufferPool::Shared().Acquire(width, height);
+    }
+    frame->GetABGRBytes(converted_.buffer.data());
+    conversions_.fetch_add(1, std::memory_order_relaxed);
+
+    converted_.width = width;
+    converted_.height = height;
+
+    return converted_;
+  }
+
+  // Returns a snapshot of this core's counters.
+  RendererStats stats() const {
+    RendererStats stats;
+    stats.conversions = conversions_.load(std::memory_order_relaxed);
+    stats.pulls = pulls_.load(std::memory_order_relaxed);
+    stats.presented_frames = presented_frames_.load(std::memory_order_relaxed);
+    stats.dropped_frames = dropped_frames_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  // Mask of the slot index in the `middle_` state.
+  static constexpr uint8_t kIndexMask = 0b011;
+
+  // Flag of the `middle_` state indicating that its slot wasn't acquired yet.
+  static constexpr uint8_t kFreshBit = 0b100;
+
+  // Exchanges the back slot with the middle one, marking it as fresh.
+  void Swap() {
+    uint8_t prev =
+        middle_.exchange(back_ | kFreshBit, std::memory_order_acq_rel);
+    back_ = prev & kIndexMask;
+    if (prev & kFreshBit) {
+      dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Not yet converted frames of this triple buffer, or `std::nullopt` if the
+  // slot was cleared.
+  std::optional<Frame> slots_[3];
+
+  // Latest acquired frame converted to `ABGR`, owned by the consumer.
+  FrameSlot converted_;
+
+  // Index of the slot owned by the consumer.
+  uint8_t front_ = 0;
+
+  // Index of the slot exchanged between the producer and the consumer, along
+  // with the `kFreshBit`.
+  std::atomic<uint8_t> middle_ = 1;
+
+  // Index of the slot owned by the producer.
+  uint8_t back_ = 2;
+
+  // Mutex serializing producers, never taken by the consumer.
+  std::mutex producer_mutex_;
+
+  // Number of frames converted to `ABGR`.
+  std::atomic<uint64_t> conversions_ = 0;
+
+  // Number of times the pixels were pulled by the consumer.
+  std::atomic<uint64_t> pulls_ = 0;
+
+  // Number of frames presented by the consumer.
+  std::atomic<uint64_t> presented_frames_ = 0;
+
+  // Number of frames dropped without being presented.
+  std::atomic<uint64_t> dropped_frames_ = 0;
+};
@@ -1,4 +1,5 @@
 use std::{
+    borrow::Cow,
     sync::{
         atomic::{AtomicBool, Ordering},
         mpsc, Arc, Mutex,
@@ -13,6 +14,7 @@ use crate::{
     devices::{self, DeviceState},
     pc::PeerConnectionId,
     renderer::FrameHandler,
+    stats,
     user_media::TrackOrigin,
     Webrtc,
 };
@@ -33,6 +35,37 @@ pub static RX_TIMEOUT: Duration = Duration::from_secs(5);
 /// Indicator whether application is configured to use fake media devices.
 static FAKE_MEDIA: AtomicBool = AtomicBool::new(false);
 
+/// [`FakeMediaOptions`] of the fake media devices, if they're enabled.
+static FAKE_MEDIA_OPTIONS: Mutex<Option<FakeMediaOptions>> = Mutex::new(None);
+
+/// [`VideoCodecConfigState`] of the [`Webrtc`] context.
+static VIDEO_CODEC_CONFIG: Mutex<VideoCodecConfigState> =
+    Mutex::new(VideoCodecConfigState::Unset);
+
+/// State of the [`sys::VideoCodecConfig`] of the [`Webrtc`] context.
+enum VideoCodecConfigState {
+    /// [`Webrtc`] context isn't created yet, and no config is set.
+    Unset,
+
+    /// [`sys::VideoCodecConfig`] to create the [`Webrtc`] context with.
+    Set(sys::VideoCodecConfig),
+
+    /// [`sys::VideoCodecConfig`] the [`Webrtc`] context is already created
+    /// with, so it can't be changed anymore.
+    Applied(sys::VideoCodecConfig),
+}
+
+impl VideoCodecConfigState {
+    /// Returns the [`sys::VideoCodecConfig`] the [`Webrtc`] context is (or
+    /// will be) created with.
+    fn config(&self) -> Cow<'_, sys::VideoCodecConfig> {
+        match self {
+            Self::Unset => Cow::Owned(sys::VideoCodecConfig::default()),
+            Self::Set(config) | Self::Applied(config) => Cow::Borrowed(config),
+        }
+    }
+}
+
 /// Fields of [`RtcStatsType::RtcMediaSourceStats`] variant.
 pub enum RtcMediaSourceStatsMediaType {
     /// Video source fields.
@@ -1090,6 +1123,86 @@ impl From<sys::RtcStats> for RtcStats {
     }
 }
 
+/// Rates derived from the difference between two consecutive snapshots of the
+/// same [`RtcStats`].
+///
+/// Every rate is [`None`] if the [`RtcStats`] don't have the values it's
+/// derived from, or if they have no previous snapshot.
+#[derive(Clone, Copy, Debug, Default, PartialEq)]
+pub struct RtcStatsRates {
+    /// Bitrate of the sent or received media, in bits per second.
+    pub bitrate: Option<f64>,
+
+    /// Rate of the sent or received packets, in packets per second.
+    pub packet_rate: Option<f64>,
+
+    /// Percentage of the packets lost since the previous snapshot.
+    ///
+    /// For the remote stats it's the last reported fraction of the lost
+    /// packets instead.
+    pub packet_loss_percent: Option<f64>,
+
+    /// Rate of the encoded, decoded or captured frames, in frames per second.
+    pub frame_rate: Option<f64>,
+
+    /// Change of the jitter since the previous snapshot, in seconds per
+    /// second.
+    ///
+    /// Positive values mean that the jitter grows.
+    pub jitter_trend: Option<f64>,
+
+    /// Number of the video freezes happened since the previous snapshot.
+    pub new_freezes: Option<u32>,
+}
+
+/// [`RtcStats`] changed since the previous [`RtcStatsUpdate`], along with the
+/// [`RtcStatsRates`] derived from their previous values.
+#[derive(Debug)]
+pub struct RtcStatsDelta {
+    /// Current [`RtcStats`].
+    pub stats: RtcStats,
+
+    /// [`RtcStatsRates`] since the previous snapshot of the [`RtcStats`].
+    pub rates: RtcStatsRates,
+}
+
+/// Changes of the [`RtcStats`] of a [`PeerConnection`] since the previous
+/// [`RtcStatsUpdate`] of the same subscription.
+#[derive(Debug)]
+pub struct RtcStatsUpdate {
+    /// [`RtcStats`] which have appeared, or whose values or rates have changed.
+    pub changed: Vec<RtcStatsDelta>,
+
+    /// IDs of the [`RtcStats`] which have disappeared.
+    pub removed: Vec<String>,
+}
+
+/// [`RtcStats`] of a single [`PeerConnection`] in an [`RtcStatsBatch`].
+#[derive(Debug)]
+pub struct RtcPeerStats {
+    /// ID of the [`PeerConnection`].
+    pub peer_id: u64,
+
+    /// [`RtcStats`] of the [`PeerConnection`].
+    ///
+    /// Empty if they haven't been collected in time.
+    pub stats: Vec<RtcStats>,
+
+    /// Indicator whether the [`RtcStats`] of the [`PeerConnection`] haven't
+    /// been collected within the time budget, or have failed to.
+    pub timed_out: bool,
+}
+
+/// [`RtcStats`] of all the [`PeerConnection`]s, collected at once.
+#[derive(Debug)]
+pub struct RtcStatsBatch {
+    /// [`RtcPeerStats`] of every [`PeerConnection`].
+    pub peers: Vec<RtcPeerStats>,
+
+    /// Time spent on collecting this [`RtcStatsBatch`], in microseconds.
+    pub elapsed_us: i64,
+}
+
 /// Indicator of the current state of a [`MediaStreamTrack`].
 #[derive(Clone, Copy, Debug, Eq, PartialEq)]
 pub enum TrackEvent {
@@ -1633,6 +1746,12 @@ pub struct VideoConstraints {
     /// Indicator whether the request video track should be acquired via screen
     /// capturing.
     pub is_display: bool,
+
+    /// Maximum share of a single CPU core the screen capturer may spend on
+    /// capturing and converting frames, in percents.
+    ///
+    /// Only applies to screen capturing, defaulting to `50` if [`None`].
+    pub cpu_budget_percentage: Option<u8>,
 }
 
 /// Nature and settings of the audio [`MediaStreamTrack`] returned by
@@ -1648,6 +1767,25 @@ pub struct AudioConstraints {
     ///           changing device will affect all previously obtained audio
     ///           tracks.
     pub device_id: Option<String>,
+
+    /// Indicator whether the echo cancellation is applied to the recorded
+    /// audio.
+    ///
+    /// **NOTE**: Audio processing is configured once the device starts being
+    ///           recorded, and is shared by all the tracks of the device.
+    pub echo_cancellation: bool,
+
+    /// Indicator whether the noise suppression is applied to the recorded
+    /// audio.
+    pub noise_suppression: bool,
+
+    /// Indicator whether the automatic gain control is applied to the recorded
+    /// audio.
+    pub auto_gain_control: bool,
+
+    /// Indicator whether the high-pass filter is applied to the recorded
+    /// audio.
+    pub high_pass_filter: bool,
 }
 
 /// Representation of a single media track within a [`MediaStream`].
@@ -1915,6 +2053,111 @@ impl From<BundlePolicy> for sys::BundlePolicy {
     }
 }
 
+/// Signal produced by fake audio devices.
+#[derive(Clone, Copy, Debug)]
+pub enum FakeAudioSignal {
+    /// Digital silence.
+    Silence,
+
+    /// Sine tone of the [`FakeMediaOptions::audio_frequency_hz`].
+    Sine,
+
+    /// Linear sweep from 100 Hz to 8 kHz, repeated every 5 seconds.
+    Sweep,
+
+    /// White noise, repeatable between runs.
+    Noise,
+
+    /// Looped contents of the [`FakeMediaOptions::audio_wav_path`] file.
+    WavFile,
+}
+
+impl From<FakeAudioSignal> for sys::FakeAudioSignal {
+    fn from(signal: FakeAudioSignal) -> Self {
+        match signal {
+            FakeAudioSignal::Silence => Self::Silence,
+            FakeAudioSignal::Sine => Self::Sine,
+            FakeAudioSignal::Sweep => Self::Sweep,
+            FakeAudioSignal::Noise => Self::Noise,
+            FakeAudioSignal::WavFile => Self::WavFile,
+        }
+    }
+}
+
+/// Content of the frames produced by fake video devices.
+#[derive(Clone, Copy, Debug)]
+pub enum FakeVideoContent {
+    /// Black frames.
+    Black,
+
+    /// Diagonal color gradient moving with every frame.
+    Gradient,
+
+    /// Pseudo-random noise, repeatable between runs.
+    Noise,
+}
+
+impl From<FakeVideoContent> for sys::FakeVideoContent {
+    fn from(content: FakeVideoContent) -> Self {
+        match content {
+            FakeVideoContent::Black => Self::Black,
+            FakeVideoContent::Gradient => Self::Gradient,
+            FakeVideoContent::Noise => Self::Noise,
+        }
+    }
+}
+
+/// Media produced by the fake devices enabled via [`enable_fake_media()`].
+#[derive(Clone, Debug)]
+pub struct FakeMediaOptions {
+    /// Content of the frames produced by fake video devices.
+    pub video_content: FakeVideoContent,
+
+    /// Indicator whether the frames produced by fake video devices are
+    /// overlaid with their number and capture time.
+    pub video_overlay: bool,
+
+    /// Signal produced by fake audio devices.
+    pub audio_signal: FakeAudioSignal,
+
+    /// Frequency of the [`FakeAudioSignal::Sine`], in Hz.
+    pub audio_frequency_hz: u32,
+
+    /// Path to the 16-bit PCM WAV file of the [`FakeAudioSignal::WavFile`].
+    pub audio_wav_path: String,
+
+    /// Interval between the audio markers, in milliseconds, or `0` to not
+    /// emit them.
+    ///
+    /// A marker replaces a whole 10 ms block with a full-scale 2 kHz tone, so
+    /// it's easily detected on the receiving side.
+    pub audio_marker_interval_ms: u32,
+}
+
+impl Default for FakeMediaOptions {
+    fn default() -> Self {
+        Self {
+            video_content: FakeVideoContent::Black,
+            video_overlay: false,
+            audio_signal: FakeAudioSignal::Silence,
+            audio_frequency_hz: 440,
+            audio_wav_path: String::new(),
+            audio_marker_interval_ms: 0,
+        }
+    }
+}
+
+impl From<FakeMediaOptions> for sys::FakeAudioOptions {
+    fn from(options: FakeMediaOptions) -> Self {
+        Self {
+            signal: options.audio_signal.into(),
+            frequency_hz: options.audio_frequency_hz,
+            wav_path: options.audio_wav_path,
+            marker_interval_ms: options.audio_marker_interval_ms,
+        }
+    }
+}
+
 /// [`get_media()`] function result.
 pub enum GetMediaResult {
     /// Requested media tracks.
@@ -1984,6 +2227,75 @@ pub enum VideoCodec {
     VP9,
 }
 
+impl From<sys::VideoCodecKind> for VideoCodec {
+    fn from(kind: sys::VideoCodecKind) -> Self {
+        match kind {
+            sys::VideoCodecKind::AV1 => Self::AV1,
+            sys::VideoCodecKind::H264 => Self::H264,
+            sys::VideoCodecKind::VP8 => Self::VP8,
+            sys::VideoCodecKind::VP9 => Self::VP9,
+            _ => unreachable!(),
+        }
+    }
+}
+
+/// Complexity of a video encoder, trading its CPU usage for the quality.
+///
+/// For [`VideoCodec::AV1`] it selects the speed preset of the encoder.
+#[derive(Clone, Copy, Debug)]
+pub enum VideoEncoderComplexity {
+    /// Lowest CPU usage.
+    Low,
+
+    /// Default complexity of the encoder.
+    Normal,
+
+    /// Higher quality at the cost of more CPU usage.
+    High,
+
+    /// Even higher quality at the cost of even more CPU usage.
+    Higher,
+
+    /// Highest quality regardless of the CPU usage.
+    Max,
+}
+
+impl From<VideoEncoderComplexity> for sys::VideoEncoderComplexity {
+    fn from(complexity: VideoEncoderComplexity) -> Self {
+        match complexity {
+            VideoEncoderComplexity::Low => Self::Low,
+            VideoEncoderComplexity::Normal => Self::Normal,
+            VideoEncoderComplexity::High => Self::High,
+            VideoEncoderComplexity::Higher => Self::Higher,
+            VideoEncoderComplexity::Max => Self::Max,
+        }
+    }
+}
+
+/// Settings of a single enabled [`VideoCodec`].
+pub struct VideoCodecSettings {
+    /// Configured [`VideoCodec`].
+    pub codec: VideoCodec,
+
+    /// [`VideoEncoderComplexity`] of the encoders of this [`VideoCodec`].
+    pub complexity: VideoEncoderComplexity,
+}
+
+/// Configuration of the video codecs of all the [`PeerConnection`]s.
+pub struct VideoCodecConfig {
+    /// Enabled [`VideoCodec`]s in their preference order, the most preferred
+    /// first.
+    ///
+    /// [`VideoCodec`]s not listed here are neither encoded nor decoded, so
+    /// they're never negotiated.
+    pub codecs: Vec<VideoCodecSettings>,
+
+    /// Indicator whether VP9 spatial scalability (SVC) modes are supported.
+    ///
+    /// If `false`, only the temporal scalability modes are offered for VP9.
+    pub vp9_svc: bool,
+}
+
 /// [`VideoCodec`] info for encoding/decoding.
 pub struct VideoCodecInfo {
     /// Indicator whether hardware acceleration should be used.
@@ -1993,63 +2305,123 @@ pub struct VideoCodecInfo {
     pub codec: VideoCodec,
 }
 
+/// Counters of the buffer pools recycling frames of the screen capturers and
+/// fake video sources.
+pub struct I420BufferPoolStats {
+    /// Total number of buffers reused from the pools.
+    pub hits: u64,
+
+    /// Total number of buffers allocated because no pooled ones were
+    /// available.
+    pub misses: u64,
+
+    /// Maximum number of buffers kept by every pool.
+    pub depth: u32,
+}
+
 /// Returns all [`VideoCodecInfo`]s of the supported video encoders.
+///
+/// Only the [`VideoCodec`]s enabled by the [`VideoCodecConfig`] are returned,
+/// in its preference order.
 pub fn video_encoders() -> Vec<VideoCodecInfo> {
     // TODO(rogurotus): Implement HW acceleration probing for desktop.
-    vec![
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::VP8,
-        },
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::VP9,
-        },
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::H264,
-        },
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::AV1,
-        },
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::H265,
-        },
-    ]
+    enabled_video_codecs()
 }
 
 /// Returns all [`VideoCodecInfo`]s of the supported video decoders.
+///
+/// Only the [`VideoCodec`]s enabled by the [`VideoCodecConfig`] are returned,
+/// in its preference order.
 pub fn video_decoders() -> Vec<VideoCodecInfo> {
     // TODO(rogurotus): Implement HW acceleration probing for desktop.
-    vec![
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::VP8,
-        },
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::VP9,
-        },
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::H264,
-        },
-        VideoCodecInfo {
-            is_hardware_accelerated: false,
-            codec: VideoCodec::AV1,
-        },
-        VideoCodecInfo {
+    enabled_video_codecs()
+}
+
+/// Returns [`VideoCodecInfo`]s of the [`VideoCodec`]s enabled by the current
+/// [`VideoCodecConfig`].
+fn enabled_video_codecs() -> Vec<VideoCodecInfo> {
+    VIDEO_CODEC_CONFIG
+        .lock()
+        .unwrap()
+        .config()
+        .codecs
+        .iter()
+        .map(|settings| VideoCodecInfo {
             is_hardware_accelerated: false,
-            codec: VideoCodec::H265,
-        },
-    ]
+            codec: settings.kind.into(),
+        })
+        .collect()
+}
+
+/// Sets the [`VideoCodecConfig`] of all the [`PeerConnection`]s.
+///
+/// The config is applied on creation of the underlying peer connection
+/// factory, so this must be called before any other function to work.
+///
+/// # Errors
+///
+/// If the peer connection factory is already created, or if the provided
+/// [`VideoCodecConfig`] enables no [`VideoCodec`]s, the same [`VideoCodec`]
+/// more than once, or the unsupported [`VideoCodec::H265`].
+#[allow(clippy::needless_pass_by_value)]
+pub fn set_video_codec_config(config: VideoCodecConfig) -> anyhow::Result<()> {
+    if config.codecs.is_empty() {
+        anyhow::bail!("At least one video codec must be enabled");
+    }
+
+    let codecs = config
+        .codecs
+        .iter()
+        .map(|settings| {
+            let kind = match settings.codec {
+                VideoCodec::AV1 => sys::VideoCodecKind::AV1,
+                VideoCodec::H264 => sys::VideoCodecKind::H264,
+                VideoCodec::VP8 => sys::VideoCodecKind::VP8,
+                VideoCodec::VP9 => sys::VideoCodecKind::VP9,
+                VideoCodec::H265 => {
+                    anyhow::bail!("H.265 video codec is not supported")
+                }
+            };
+            Ok(sys::VideoCodecSettings {
+                kind,
+                complexity: settings.complexity.into(),
+            })
+        })
+        .collect::<anyhow::Result<Vec<_>>>()?;
+    for (i, settings) in codecs.iter().enumerate() {
+        if codecs[..i].iter().any(|s| s.kind == settings.kind) {
+            anyhow::bail!("{:?} video codec is enabled twice", settings.kind);
+        }
+    }
+
+    let mut state = VIDEO_CODEC_CONFIG.lock().unwrap();
+    if matches!(*state, VideoCodecConfigState::Applied(_)) {
+        anyhow::bail!(
+            "`VideoCodecConfig` must be set before any other function is \
+             called",
+        );
+    }
+    *state = VideoCodecConfigState::Set(sys::VideoCodecConfig {
+        codecs,
+        vp9_svc: config.vp9_svc,
+    });
+    Ok(())
+}
+
+/// Returns the [`sys::VideoCodecConfig`] to create the [`Webrtc`] context
+/// with, so it can't be changed anymore.
+pub(crate) fn apply_video_codec_config() -> sys::VideoCodecConfig {
+    let mut state = VIDEO_CODEC_CONFIG.lock().unwrap();
+    let config = state.config().into_owned();
+    *state = VideoCodecConfigState::Applied(config.clone());
+    config
 }
 
 /// Configures media acquisition to use fake devices instead of actual camera
-/// and microphone.
-pub fn enable_fake_media() {
+/// and microphone, producing the media of the provided [`FakeMediaOptions`].
+#[allow(clippy::needless_pass_by_value)]
+pub fn enable_fake_media(options: FakeMediaOptions) {
+    *FAKE_MEDIA_OPTIONS.lock().unwrap() = Some(options);
     FAKE_MEDIA.store(true, Ordering::Release);
 }
 
@@ -2058,6 +2430,35 @@ pub fn is_fake_media() -> bool {
     FAKE_MEDIA.load(Ordering::Acquire)
 }
 
+/// Returns the [`FakeMediaOptions`] of the fake media devices.
+pub(crate) fn fake_media_options() -> FakeMediaOptions {
+    FAKE_MEDIA_OPTIONS
+        .lock()
+        .unwrap()
+        .clone()
+        .unwrap_or_default()
+}
+
+/// Returns the [`I420BufferPoolStats`] of all the screen capturers and fake
+/// video sources.
+pub fn i420_buffer_pool_stats() -> I420BufferPoolStats {
+    let stats = sys::i420_buffer_pool_stats();
+
+    I420BufferPoolStats {
+        hits: stats.hits,
+        misses: stats.misses,
+        depth: u32::try_from(stats.depth).unwrap_or(u32::MAX),
+    }
+}
+
+/// Sets the maximum number of buffers kept by the pool of every screen
+/// capturer and fake video source.
+///
+/// Zero disables the recycling, so every frame is allocated anew.
+pub fn set_i420_buffer_pool_depth(depth: u32) {
+    sys::set_i420_buffer_pool_depth(depth as usize);
+}
+
 /// Returns a list of all available media input and output devices, such as
 /// microphones, cameras, headsets, and so forth.
 pub fn enumerate_devices() -> anyhow::Result<Vec<MediaDeviceInfo>> {
@@ -2222,6 +2623,84 @@ pub fn get_peer_stats(
         .collect())
 }
 
+/// Returns [`RtcStats`] of the [`PeerConnection`] of the provided types only,
+/// optionally limited to the provided tracks and transceivers.
+///
+/// `type_mask` bit `n` selects the [`RtcStatsType`] variant with index `n` (in
+/// the declaration order), so `0x04` selects the outbound RTP streams only.
+///
+/// If `ids` are not empty, only the stats of the tracks and transceivers (by
+/// their `mid`s) with these IDs are collected, via the selector-based
+/// `getStats()`.
+#[allow(clippy::needless_pass_by_value)]
+pub fn get_peer_stats_filtered(
+    peer: RustOpaque<Arc<PeerConnection>>,
+    type_mask: u32,
+    ids: Vec<String>,
+) -> anyhow::Result<Vec<RtcStats>> {
+    let types = sys::RtcStatsTypes::from_bits(type_mask);
+    let (tx, rx) = mpsc::channel();
+
+    if ids.is_empty() {
+        peer.get_stats(tx);
+    } else {
+        peer.get_selected_stats(ids, types, tx);
+    }
+    let report = rx.recv_timeout(RX_TIMEOUT)?;
+
+    Ok(report
+        .get_filtered_stats(types)?
+        .into_iter()
+        .map(RtcStats::from)
+        .collect())
+}
+
+/// Returns [`RtcStats`] of the provided types of all the [`PeerConnection`]s
+/// at once.
+///
+/// `type_mask` is the same as in the [`get_peer_stats_filtered()`]. Stats of
+/// all the [`PeerConnection`]s are collected concurrently, waiting no longer
+/// than `budget_ms` in total, so the ones not collected by then are marked as
+/// timed out.
+pub fn get_all_peers_stats(type_mask: u32, budget_ms: u32) -> RtcStatsBatch {
+    let peers = WEBRTC.lock().unwrap().peer_connections();
+
+    stats::collect_batch(
+        &peers,
+        sys::RtcStatsTypes::from_bits(type_mask),
+        Duration::from_millis(u64::from(budget_ms)),
+    )
+}
+
+/// Subscribes to the changes of the [`RtcStats`] of the [`PeerConnection`].
+///
+/// Every `interval_ms` the [`RtcStats`] of the types in the `type_mask` (see
+/// [`get_peer_stats_filtered()`]) are loaded, and an [`RtcStatsUpdate`] with
+/// the changed ones only is sent, unless nothing has changed. The first update
+/// contains all the [`RtcStats`].
+///
+/// The subscription ends once the returned stream is cancelled or the
+/// [`PeerConnection`] is dropped.
+#[allow(clippy::needless_pass_by_value)]
+pub fn subscribe_peer_stats(
+    cb: StreamSink<RtcStatsUpdate>,
+    peer: RustOpaque<Arc<PeerConnection>>,
+    interval_ms: u32,
+    type_mask: u32,
+) -> anyhow::Result<()> {
+    if interval_ms == 0 {
+        anyhow::bail!("Stats subscription interval must be positive");
+    }
+
+    stats::subscribe(
+        &peer,
+        Duration::from_millis(u64::from(interval_ms)),
+        sys::RtcStatsTypes::from_bits(type_mask),
+        cb.into(),
+    );
+    Ok(())
+}
+
 /// Irreversibly marks the specified [`RtcRtpTransceiver`] as stopping, unless
 /// it's already stopped.
 ///
@@ -2303,7 +2782,17 @@ pub fn get_media(constraints: MediaStreamConstraints) -> GetMediaResult {
 
 /// Sets the specified `audio playout` device.
 pub fn set_audio_playout_device(device_id: String) -> anyhow::Result<()> {
-    WEBRTC.lock().unwrap().set_audio_playout_device(device_id)
+    let (tx, rx) = mpsc::channel();
+
+    WEBRTC
+        .lock()
+        .unwrap()
+        .set_audio_playout_device(device_id, tx)?;
+
+    // `WEBRTC` isn't locked while the `AudioDeviceModule` changes the device.
+    rx.recv_timeout(RX_TIMEOUT)??;
+
+    WEBRTC.lock().unwrap().restart_audio_playout()
 }
 
 /// Indicates whether the microphone is available to set volume.
@@ -2316,7 +2805,11 @@ pub fn microphone_volume_is_available() -> anyhow::Result<bool> {
 ///
 /// Valid values range is `[0; 100]`.
 pub fn set_microphone_volume(level: u8) -> anyhow::Result<()> {
-    WEBRTC.lock().unwrap().set_microphone_volume(level)
+    let (tx, rx) = mpsc::channel();
+
+    WEBRTC.lock().unwrap().set_microphone_volume(level, tx)?;
+
+    rx.recv_timeout(RX_TIMEOUT)?
 }
 
 /// Returns the current level of the microphone volume in `[0; 100]` range.
@@ -2324,6 +2817,16 @@ pub fn microphone_volume() -> anyhow::Result<u32> {
     WEBRTC.lock().unwrap().microphone_volume()
 }
 
+/// Sets the number of 10 ms buffers kept queued for the audio playout, trading
+/// the playout latency against the risk of underruns.
+///
+/// Restarts the playout if it's active already.
+pub fn set_playout_buffer_depth(buffers: u32) -> anyhow::Result<()> {
+    let buffers = u16::try_from(buffers)?;
+
+    WEBRTC.lock().unwrap().set_playout_buffer_depth(buffers)
+}
+
 /// Disposes the specified [`MediaStreamTrack`].
 pub fn dispose_track(track_id: String, peer_id: Option<u64>, kind: MediaType) {
     let track_origin = TrackOrigin::from(peer_id.map(PeerConnectionId::from));
@@ -2490,3 +2993,20 @@ pub fn create_video_sink(
 pub fn dispose_video_sink(sink_id: i64) {
     WEBRTC.lock().unwrap().dispose_video_sink(sink_id);
 }
+
+/// Sets the size (in physical pixels) the [`VideoSink`] with the provided ID
+/// is rendered at, and the maximum framerate it should be rendered with, so
+/// the video is adapted accordingly.
+///
+/// Zero values mean no constraint.
+pub fn set_video_sink_wants(
+    sink_id: i64,
+    max_width: i32,
+    max_height: i32,
+    max_fps: i32,
+) -> anyhow::Result<()> {
+    WEBRTC
+        .lock()
+        .unwrap()
+        .set_video_sink_wants(sink_id, max_width, max_height, max_fps)
+}
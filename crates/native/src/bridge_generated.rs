@@ -44,14 +44,36 @@ fn wire_video_decoders_impl(port_: MessagePort) {
         move || move |task_callback| Result::<_, ()>::Ok(video_decoders()),
     )
 }
-fn wire_enable_fake_media_impl(port_: MessagePort) {
+fn wire_set_video_codec_config_impl(
+    port_: MessagePort,
+    config: impl Wire2Api<VideoCodecConfig> + UnwindSafe,
+) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, (), _>(
+        WrapInfo {
+            debug_name: "set_video_codec_config",
+            port: Some(port_),
+            mode: FfiCallMode::Normal,
+        },
+        move || {
+            let api_config = config.wire2api();
+            move |task_callback| set_video_codec_config(api_config)
+        },
+    )
+}
+fn wire_enable_fake_media_impl(
+    port_: MessagePort,
+    options: impl Wire2Api<FakeMediaOptions> + UnwindSafe,
+) {
     FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, (), _>(
         WrapInfo {
             debug_name: "enable_fake_media",
             port: Some(port_),
             mode: FfiCallMode::Normal,
         },
-        move || move |task_callback| Result::<_, ()>::Ok(enable_fake_media()),
+        move || {
+            let api_options = options.wire2api();
+            move |task_callback| Result::<_, ()>::Ok(enable_fake_media(api_options))
+        },
     )
 }
 fn wire_is_fake_media_impl(port_: MessagePort) {
@@ -64,6 +86,29 @@ fn wire_is_fake_media_impl(port_: MessagePort) {
         move || move |task_callback| Result::<_, ()>::Ok(is_fake_media()),
     )
 }
+fn wire_i420_buffer_pool_stats_impl(port_: MessagePort) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, I420BufferPoolStats, _>(
+        WrapInfo {
+            debug_name: "i420_buffer_pool_stats",
+            port: Some(port_),
+            mode: FfiCallMode::Normal,
+        },
+        move || move |task_callback| Result::<_, ()>::Ok(i420_buffer_pool_stats()),
+    )
+}
+fn wire_set_i420_buffer_pool_depth_impl(port_: MessagePort, depth: impl Wire2Api<u32> + UnwindSafe) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, (), _>(
+        WrapInfo {
+            debug_name: "set_i420_buffer_pool_depth",
+            port: Some(port_),
+            mode: FfiCallMode::Normal,
+        },
+        move || {
+            let api_depth = depth.wire2api();
+            move |task_callback| Result::<_, ()>::Ok(set_i420_buffer_pool_depth(api_depth))
+        },
+    )
+}
 fn wire_enumerate_devices_impl(port_: MessagePort) {
     FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, Vec<MediaDeviceInfo>, _>(
         WrapInfo {
@@ -341,6 +386,71 @@ fn wire_get_peer_stats_impl(
         },
     )
 }
+fn wire_get_peer_stats_filtered_impl(
+    port_: MessagePort,
+    peer: impl Wire2Api<RustOpaque<Arc<PeerConnection>>> + UnwindSafe,
+    type_mask: impl Wire2Api<u32> + UnwindSafe,
+    ids: impl Wire2Api<Vec<String>> + UnwindSafe,
+) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, Vec<RtcStats>, _>(
+        WrapInfo {
+            debug_name: "get_peer_stats_filtered",
+            port: Some(port_),
+            mode: FfiCallMode::Normal,
+        },
+        move || {
+            let api_peer = peer.wire2api();
+            let api_type_mask = type_mask.wire2api();
+            let api_ids = ids.wire2api();
+            move |task_callback| get_peer_stats_filtered(api_peer, api_type_mask, api_ids)
+        },
+    )
+}
+fn wire_get_all_peers_stats_impl(
+    port_: MessagePort,
+    type_mask: impl Wire2Api<u32> + UnwindSafe,
+    budget_ms: impl Wire2Api<u32> + UnwindSafe,
+) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, RtcStatsBatch, _>(
+        WrapInfo {
+            debug_name: "get_all_peers_stats",
+            port: Some(port_),
+            mode: FfiCallMode::Normal,
+        },
+        move || {
+            let api_type_mask = type_mask.wire2api();
+            let api_budget_ms = budget_ms.wire2api();
+            move |task_callback| Result::<_, ()>::Ok(get_all_peers_stats(api_type_mask, api_budget_ms))
+        },
+    )
+}
+fn wire_subscribe_peer_stats_impl(
+    port_: MessagePort,
+    peer: impl Wire2Api<RustOpaque<Arc<PeerConnection>>> + UnwindSafe,
+    interval_ms: impl Wire2Api<u32> + UnwindSafe,
+    type_mask: impl Wire2Api<u32> + UnwindSafe,
+) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, (), _>(
+        WrapInfo {
+            debug_name: "subscribe_peer_stats",
+            port: Some(port_),
+            mode: FfiCallMode::Stream,
+        },
+        move || {
+            let api_peer = peer.wire2api();
+            let api_interval_ms = interval_ms.wire2api();
+            let api_type_mask = type_mask.wire2api();
+            move |task_callback| {
+                subscribe_peer_stats(
+                    task_callback.stream_sink::<_, RtcStatsUpdate>(),
+                    api_peer,
+                    api_interval_ms,
+                    api_type_mask,
+                )
+            }
+        },
+    )
+}
 fn wire_stop_transceiver_impl(
     port_: MessagePort,
     transceiver: impl Wire2Api<RustOpaque<Arc<RtpTransceiver>>> + UnwindSafe,
@@ -532,6 +642,19 @@ fn wire_microphone_volume_impl(port_: MessagePort) {
         move || move |task_callback| microphone_volume(),
     )
 }
+fn wire_set_playout_buffer_depth_impl(port_: MessagePort, buffers: impl Wire2Api<u32> + UnwindSafe) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, (), _>(
+        WrapInfo {
+            debug_name: "set_playout_buffer_depth",
+            port: Some(port_),
+            mode: FfiCallMode::Normal,
+        },
+        move || {
+            let api_buffers = buffers.wire2api();
+            move |task_callback| set_playout_buffer_depth(api_buffers)
+        },
+    )
+}
 fn wire_dispose_track_impl(
     port_: MessagePort,
     track_id: impl Wire2Api<String> + UnwindSafe,
@@ -739,6 +862,30 @@ fn wire_dispose_video_sink_impl(port_: MessagePort, sink_id: impl Wire2Api<i64>
         },
     )
 }
+fn wire_set_video_sink_wants_impl(
+    port_: MessagePort,
+    sink_id: impl Wire2Api<i64> + UnwindSafe,
+    max_width: impl Wire2Api<i32> + UnwindSafe,
+    max_height: impl Wire2Api<i32> + UnwindSafe,
+    max_fps: impl Wire2Api<i32> + UnwindSafe,
+) {
+    FLUTTER_RUST_BRIDGE_HANDLER.wrap::<_, _, _, (), _>(
+        WrapInfo {
+            debug_name: "set_video_sink_wants",
+            port: Some(port_),
+            mode: FfiCallMode::Normal,
+        },
+        move || {
+            let api_sink_id = sink_id.wire2api();
+            let api_max_width = max_width.wire2api();
+            let api_max_height = max_height.wire2api();
+            let api_max_fps = max_fps.wire2api();
+            move |task_callback| {
+                set_video_sink_wants(api_sink_id, api_max_width, api_max_height, api_max_fps)
+            }
+        },
+    )
+}
 // Section: wrapper structs
 
 // Section: static checks
@@ -778,6 +925,28 @@ impl Wire2Api<BundlePolicy> for i32 {
         }
     }
 }
+impl Wire2Api<FakeAudioSignal> for i32 {
+    fn wire2api(self) -> FakeAudioSignal {
+        match self {
+            0 => FakeAudioSignal::Silence,
+            1 => FakeAudioSignal::Sine,
+            2 => FakeAudioSignal::Sweep,
+            3 => FakeAudioSignal::Noise,
+            4 => FakeAudioSignal::WavFile,
+            _ => unreachable!("Invalid variant for FakeAudioSignal: {}", self),
+        }
+    }
+}
+impl Wire2Api<FakeVideoContent> for i32 {
+    fn wire2api(self) -> FakeVideoContent {
+        match self {
+            0 => FakeVideoContent::Black,
+            1 => FakeVideoContent::Gradient,
+            2 => FakeVideoContent::Noise,
+            _ => unreachable!("Invalid variant for FakeVideoContent: {}", self),
+        }
+    }
+}
 impl Wire2Api<f64> for f64 {
     fn wire2api(self) -> f64 {
         self
@@ -854,6 +1023,30 @@ impl Wire2Api<u8> for u8 {
         self
     }
 }
+impl Wire2Api<VideoCodec> for i32 {
+    fn wire2api(self) -> VideoCodec {
+        match self {
+            0 => VideoCodec::AV1,
+            1 => VideoCodec::H264,
+            2 => VideoCodec::H265,
+            3 => VideoCodec::VP8,
+            4 => VideoCodec::VP9,
+            _ => unreachable!("Invalid variant for VideoCodec: {}", self),
+        }
+    }
+}
+impl Wire2Api<VideoEncoderComplexity> for i32 {
+    fn wire2api(self) -> VideoEncoderComplexity {
+        match self {
+            0 => VideoEncoderComplexity::Low,
+            1 => VideoEncoderComplexity::Normal,
+            2 => VideoEncoderComplexity::High,
+            3 => VideoEncoderComplexity::Higher,
+            4 => VideoEncoderComplexity::Max,
+            _ => unreachable!("Invalid variant for VideoEncoderComplexity: {}", self),
+        }
+    }
+}
 
 // Section: impl IntoDart
 
@@ -907,6 +1100,23 @@ impl rust2dart::IntoIntoDart<GetMediaResult> for GetMediaResult {
     }
 }
 
+impl support::IntoDart for I420BufferPoolStats {
+    fn into_dart(self) -> support::DartAbi {
+        vec![
+            self.hits.into_into_dart().into_dart(),
+            self.misses.into_into_dart().into_dart(),
+            self.depth.into_into_dart().into_dart(),
+        ]
+        .into_dart()
+    }
+}
+impl support::IntoDartExceptPrimitive for I420BufferPoolStats {}
+impl rust2dart::IntoIntoDart<I420BufferPoolStats> for I420BufferPoolStats {
+    fn into_into_dart(self) -> Self {
+        self
+    }
+}
+
 impl support::IntoDart for IceCandidateStats {
     fn into_dart(self) -> support::DartAbi {
         vec![
@@ -1306,6 +1516,23 @@ impl rust2dart::IntoIntoDart<RtcOutboundRtpStreamStatsMediaType>
     }
 }
 
+impl support::IntoDart for RtcPeerStats {
+    fn into_dart(self) -> support::DartAbi {
+        vec![
+            self.peer_id.into_into_dart().into_dart(),
+            self.stats.into_into_dart().into_dart(),
+            self.timed_out.into_into_dart().into_dart(),
+        ]
+        .into_dart()
+    }
+}
+impl support::IntoDartExceptPrimitive for RtcPeerStats {}
+impl rust2dart::IntoIntoDart<RtcPeerStats> for RtcPeerStats {
+    fn into_into_dart(self) -> Self {
+        self
+    }
+}
+
 impl support::IntoDart for RtcRtpEncodingParameters {
     fn into_dart(self) -> support::DartAbi {
         vec![
@@ -1393,6 +1620,38 @@ impl rust2dart::IntoIntoDart<RtcStats> for RtcStats {
     }
 }
 
+impl support::IntoDart for RtcStatsBatch {
+    fn into_dart(self) -> support::DartAbi {
+        vec![
+            self.peers.into_into_dart().into_dart(),
+            self.elapsed_us.into_into_dart().into_dart(),
+        ]
+        .into_dart()
+    }
+}
+impl support::IntoDartExceptPrimitive for RtcStatsBatch {}
+impl rust2dart::IntoIntoDart<RtcStatsBatch> for RtcStatsBatch {
+    fn into_into_dart(self) -> Self {
+        self
+    }
+}
+
+impl support::IntoDart for RtcStatsDelta {
+    fn into_dart(self) -> support::DartAbi {
+        vec![
+            self.stats.into_into_dart().into_dart(),
+            self.rates.into_into_dart().into_dart(),
+        ]
+        .into_dart()
+    }
+}
+impl support::IntoDartExceptPrimitive for RtcStatsDelta {}
+impl rust2dart::IntoIntoDart<RtcStatsDelta> for RtcStatsDelta {
+    fn into_into_dart(self) -> Self {
+        self
+    }
+}
+
 impl support::IntoDart for RtcStatsIceCandidatePairState {
     fn into_dart(self) -> support::DartAbi {
         match self {
@@ -1412,6 +1671,26 @@ impl rust2dart::IntoIntoDart<RtcStatsIceCandidatePairState> for RtcStatsIceCandi
     }
 }
 
+impl support::IntoDart for RtcStatsRates {
+    fn into_dart(self) -> support::DartAbi {
+        vec![
+            self.bitrate.into_dart(),
+            self.packet_rate.into_dart(),
+            self.packet_loss_percent.into_dart(),
+            self.frame_rate.into_dart(),
+            self.jitter_trend.into_dart(),
+            self.new_freezes.into_dart(),
+        ]
+        .into_dart()
+    }
+}
+impl support::IntoDartExceptPrimitive for RtcStatsRates {}
+impl rust2dart::IntoIntoDart<RtcStatsRates> for RtcStatsRates {
+    fn into_into_dart(self) -> Self {
+        self
+    }
+}
+
 impl support::IntoDart for RtcStatsType {
     fn into_dart(self) -> support::DartAbi {
         match self {
@@ -1530,6 +1809,22 @@ impl rust2dart::IntoIntoDart<RtcStatsType> for RtcStatsType {
     }
 }
 
+impl support::IntoDart for RtcStatsUpdate {
+    fn into_dart(self) -> support::DartAbi {
+        vec![
+            self.changed.into_into_dart().into_dart(),
+            self.removed.into_into_dart().into_dart(),
+        ]
+        .into_dart()
+    }
+}
+impl support::IntoDartExceptPrimitive for RtcStatsUpdate {}
+impl rust2dart::IntoIntoDart<RtcStatsUpdate> for RtcStatsUpdate {
+    fn into_into_dart(self) -> Self {
+        self
+    }
+}
+
 impl support::IntoDart for RtcTrackEvent {
     fn into_dart(self) -> support::DartAbi {
         vec![
@@ -1720,8 +2015,13 @@ mod io {
     }
 
     #[no_mangle]
-    pub extern "C" fn wire_enable_fake_media(port_: i64) {
-        wire_enable_fake_media_impl(port_)
+    pub extern "C" fn wire_set_video_codec_config(port_: i64, config: *mut wire_VideoCodecConfig) {
+        wire_set_video_codec_config_impl(port_, config)
+    }
+
+    #[no_mangle]
+    pub extern "C" fn wire_enable_fake_media(port_: i64, options: *mut wire_FakeMediaOptions) {
+        wire_enable_fake_media_impl(port_, options)
     }
 
     #[no_mangle]
@@ -1729,6 +2029,16 @@ mod io {
         wire_is_fake_media_impl(port_)
     }
 
+    #[no_mangle]
+    pub extern "C" fn wire_i420_buffer_pool_stats(port_: i64) {
+        wire_i420_buffer_pool_stats_impl(port_)
+    }
+
+    #[no_mangle]
+    pub extern "C" fn wire_set_i420_buffer_pool_depth(port_: i64, depth: u32) {
+        wire_set_i420_buffer_pool_depth_impl(port_, depth)
+    }
+
     #[no_mangle]
     pub extern "C" fn wire_enumerate_devices(port_: i64) {
         wire_enumerate_devices_impl(port_)
@@ -1861,6 +2171,31 @@ mod io {
         wire_get_peer_stats_impl(port_, peer)
     }
 
+    #[no_mangle]
+    pub extern "C" fn wire_get_peer_stats_filtered(
+        port_: i64,
+        peer: wire_ArcPeerConnection,
+        type_mask: u32,
+        ids: *mut wire_StringList,
+    ) {
+        wire_get_peer_stats_filtered_impl(port_, peer, type_mask, ids)
+    }
+
+    #[no_mangle]
+    pub extern "C" fn wire_get_all_peers_stats(port_: i64, type_mask: u32, budget_ms: u32) {
+        wire_get_all_peers_stats_impl(port_, type_mask, budget_ms)
+    }
+
+    #[no_mangle]
+    pub extern "C" fn wire_subscribe_peer_stats(
+        port_: i64,
+        peer: wire_ArcPeerConnection,
+        interval_ms: u32,
+        type_mask: u32,
+    ) {
+        wire_subscribe_peer_stats_impl(port_, peer, interval_ms, type_mask)
+    }
+
     #[no_mangle]
     pub extern "C" fn wire_stop_transceiver(port_: i64, transceiver: wire_ArcRtpTransceiver) {
         wire_stop_transceiver_impl(port_, transceiver)
@@ -1936,6 +2271,11 @@ mod io {
         wire_microphone_volume_impl(port_)
     }
 
+    #[no_mangle]
+    pub extern "C" fn wire_set_playout_buffer_depth(port_: i64, buffers: u32) {
+        wire_set_playout_buffer_depth_impl(port_, buffers)
+    }
+
     #[no_mangle]
     pub extern "C" fn wire_dispose_track(
         port_: i64,
@@ -2029,6 +2369,17 @@ mod io {
         wire_dispose_video_sink_impl(port_, sink_id)
     }
 
+    #[no_mangle]
+    pub extern "C" fn wire_set_video_sink_wants(
+        port_: i64,
+        sink_id: i64,
+        max_width: i32,
+        max_height: i32,
+        max_fps: i32,
+    ) {
+        wire_set_video_sink_wants_impl(port_, sink_id, max_width, max_height, max_fps)
+    }
+
     // Section: allocate functions
 
     #[no_mangle]
@@ -2065,6 +2416,11 @@ mod io {
         support::new_leak_box_ptr(wire_AudioConstraints::new_with_null_ptr())
     }
 
+    #[no_mangle]
+    pub extern "C" fn new_box_autoadd_fake_media_options_0() -> *mut wire_FakeMediaOptions {
+        support::new_leak_box_ptr(wire_FakeMediaOptions::new_with_null_ptr())
+    }
+
     #[no_mangle]
     pub extern "C" fn new_box_autoadd_f64_0(value: f64) -> *mut f64 {
         support::new_leak_box_ptr(value)
@@ -2102,6 +2458,16 @@ mod io {
         support::new_leak_box_ptr(value)
     }
 
+    #[no_mangle]
+    pub extern "C" fn new_box_autoadd_u8_0(value: u8) -> *mut u8 {
+        support::new_leak_box_ptr(value)
+    }
+
+    #[no_mangle]
+    pub extern "C" fn new_box_autoadd_video_codec_config_0() -> *mut wire_VideoCodecConfig {
+        support::new_leak_box_ptr(wire_VideoCodecConfig::new_with_null_ptr())
+    }
+
     #[no_mangle]
     pub extern "C" fn new_box_autoadd_video_constraints_0() -> *mut wire_VideoConstraints {
         support::new_leak_box_ptr(wire_VideoConstraints::new_with_null_ptr())
@@ -2138,6 +2504,17 @@ mod io {
         support::new_leak_box_ptr(wrap)
     }
 
+    #[no_mangle]
+    pub extern "C" fn new_list_video_codec_settings_0(
+        len: i32,
+    ) -> *mut wire_list_video_codec_settings {
+        let wrap = wire_list_video_codec_settings {
+            ptr: support::new_leak_vec_ptr(<wire_VideoCodecSettings>::new_with_null_ptr(), len),
+            len,
+        };
+        support::new_leak_box_ptr(wrap)
+    }
+
     #[no_mangle]
     pub extern "C" fn new_uint_8_list_0(len: i32) -> *mut wire_uint_8_list {
         let ans = wire_uint_8_list {
@@ -2265,6 +2642,10 @@ mod io {
         fn wire2api(self) -> AudioConstraints {
             AudioConstraints {
                 device_id: self.device_id.wire2api(),
+                echo_cancellation: self.echo_cancellation.wire2api(),
+                noise_suppression: self.noise_suppression.wire2api(),
+                auto_gain_control: self.auto_gain_control.wire2api(),
+                high_pass_filter: self.high_pass_filter.wire2api(),
             }
         }
     }
@@ -2275,6 +2656,12 @@ mod io {
             Wire2Api::<AudioConstraints>::wire2api(*wrap).into()
         }
     }
+    impl Wire2Api<FakeMediaOptions> for *mut wire_FakeMediaOptions {
+        fn wire2api(self) -> FakeMediaOptions {
+            let wrap = unsafe { support::box_from_leak_ptr(self) };
+            Wire2Api::<FakeMediaOptions>::wire2api(*wrap).into()
+        }
+    }
     impl Wire2Api<f64> for *mut f64 {
         fn wire2api(self) -> f64 {
             unsafe { *support::box_from_leak_ptr(self) }
@@ -2314,6 +2701,17 @@ mod io {
             unsafe { *support::box_from_leak_ptr(self) }
         }
     }
+    impl Wire2Api<u8> for *mut u8 {
+        fn wire2api(self) -> u8 {
+            unsafe { *support::box_from_leak_ptr(self) }
+        }
+    }
+    impl Wire2Api<VideoCodecConfig> for *mut wire_VideoCodecConfig {
+        fn wire2api(self) -> VideoCodecConfig {
+            let wrap = unsafe { support::box_from_leak_ptr(self) };
+            Wire2Api::<VideoCodecConfig>::wire2api(*wrap).into()
+        }
+    }
     impl Wire2Api<VideoConstraints> for *mut wire_VideoConstraints {
         fn wire2api(self) -> VideoConstraints {
             let wrap = unsafe { support::box_from_leak_ptr(self) };
@@ -2360,6 +2758,28 @@ mod io {
             vec.into_iter().map(Wire2Api::wire2api).collect()
         }
     }
+    impl Wire2Api<Vec<VideoCodecSettings>> for *mut wire_list_video_codec_settings {
+        fn wire2api(self) -> Vec<VideoCodecSettings> {
+            let vec = unsafe {
+                let wrap = support::box_from_leak_ptr(self);
+                support::vec_from_leak_ptr(wrap.ptr, wrap.len)
+            };
+            vec.into_iter().map(Wire2Api::wire2api).collect()
+        }
+    }
+    impl Wire2Api<FakeMediaOptions> for wire_FakeMediaOptions {
+        fn wire2api(self) -> FakeMediaOptions {
+            FakeMediaOptions {
+                video_content: self.video_content.wire2api(),
+                video_overlay: self.video_overlay.wire2api(),
+                audio_signal: self.audio_signal.wire2api(),
+                audio_frequency_hz: self.audio_frequency_hz.wire2api(),
+                audio_wav_path: self.audio_wav_path.wire2api(),
+                audio_marker_interval_ms: self.audio_marker_interval_ms.wire2api(),
+            }
+        }
+    }
+
     impl Wire2Api<MediaStreamConstraints> for wire_MediaStreamConstraints {
         fn wire2api(self) -> MediaStreamConstraints {
             MediaStreamConstraints {
@@ -2425,6 +2845,22 @@ mod io {
             }
         }
     }
+    impl Wire2Api<VideoCodecConfig> for wire_VideoCodecConfig {
+        fn wire2api(self) -> VideoCodecConfig {
+            VideoCodecConfig {
+                codecs: self.codecs.wire2api(),
+                vp9_svc: self.vp9_svc.wire2api(),
+            }
+        }
+    }
+    impl Wire2Api<VideoCodecSettings> for wire_VideoCodecSettings {
+        fn wire2api(self) -> VideoCodecSettings {
+            VideoCodecSettings {
+                codec: self.codec.wire2api(),
+                complexity: self.complexity.wire2api(),
+            }
+        }
+    }
     impl Wire2Api<VideoConstraints> for wire_VideoConstraints {
         fn wire2api(self) -> VideoConstraints {
             VideoConstraints {
@@ -2433,6 +2869,7 @@ mod io {
                 height: self.height.wire2api(),
                 frame_rate: self.frame_rate.wire2api(),
                 is_display: self.is_display.wire2api(),
+                cpu_budget_percentage: self.cpu_budget_percentage.wire2api(),
             }
         }
     }
@@ -2480,6 +2917,10 @@ mod io {
     #[derive(Clone)]
     pub struct wire_AudioConstraints {
         device_id: *mut wire_uint_8_list,
+        echo_cancellation: bool,
+        noise_suppression: bool,
+        auto_gain_control: bool,
+        high_pass_filter: bool,
     }
 
     #[repr(C)]
@@ -2503,6 +2944,17 @@ mod io {
         len: i32,
     }
 
+    #[repr(C)]
+    #[derive(Clone)]
+    pub struct wire_FakeMediaOptions {
+        video_content: i32,
+        video_overlay: bool,
+        audio_signal: i32,
+        audio_frequency_hz: u32,
+        audio_wav_path: *mut wire_uint_8_list,
+        audio_marker_interval_ms: u32,
+    }
+
     #[repr(C)]
     #[derive(Clone)]
     pub struct wire_MediaStreamConstraints {
@@ -2558,6 +3010,27 @@ mod io {
         len: i32,
     }
 
+    #[repr(C)]
+    #[derive(Clone)]
+    pub struct wire_list_video_codec_settings {
+        ptr: *mut wire_VideoCodecSettings,
+        len: i32,
+    }
+
+    #[repr(C)]
+    #[derive(Clone)]
+    pub struct wire_VideoCodecConfig {
+        codecs: *mut wire_list_video_codec_settings,
+        vp9_svc: bool,
+    }
+
+    #[repr(C)]
+    #[derive(Clone)]
+    pub struct wire_VideoCodecSettings {
+        codec: i32,
+        complexity: i32,
+    }
+
     #[repr(C)]
     #[derive(Clone)]
     pub struct wire_VideoConstraints {
@@ -2566,6 +3039,7 @@ mod io {
         height: u32,
         frame_rate: u32,
         is_display: bool,
+        cpu_budget_percentage: *mut u8,
     }
 
     // Section: impl NewWithNullPtr
@@ -2628,6 +3102,10 @@ mod io {
         fn new_with_null_ptr() -> Self {
             Self {
                 device_id: core::ptr::null_mut(),
+                echo_cancellation: Default::default(),
+                noise_suppression: Default::default(),
+                auto_gain_control: Default::default(),
+                high_pass_filter: Default::default(),
             }
         }
     }
@@ -2638,6 +3116,25 @@ mod io {
         }
     }
 
+    impl NewWithNullPtr for wire_FakeMediaOptions {
+        fn new_with_null_ptr() -> Self {
+            Self {
+                video_content: Default::default(),
+                video_overlay: Default::default(),
+                audio_signal: Default::default(),
+                audio_frequency_hz: Default::default(),
+                audio_wav_path: core::ptr::null_mut(),
+                audio_marker_interval_ms: Default::default(),
+            }
+        }
+    }
+
+    impl Default for wire_FakeMediaOptions {
+        fn default() -> Self {
+            Self::new_with_null_ptr()
+        }
+    }
+
     impl NewWithNullPtr for wire_MediaStreamConstraints {
         fn new_with_null_ptr() -> Self {
             Self {
@@ -2742,6 +3239,7 @@ mod io {
                 height: Default::default(),
                 frame_rate: Default::default(),
                 is_display: Default::default(),
+                cpu_budget_percentage: core::ptr::null_mut(),
             }
         }
     }
@@ -2752,6 +3250,36 @@ mod io {
         }
     }
 
+    impl NewWithNullPtr for wire_VideoCodecConfig {
+        fn new_with_null_ptr() -> Self {
+            Self {
+                codecs: core::ptr::null_mut(),
+                vp9_svc: Default::default(),
+            }
+        }
+    }
+
+    impl Default for wire_VideoCodecConfig {
+        fn default() -> Self {
+            Self::new_with_null_ptr()
+        }
+    }
+
+    impl NewWithNullPtr for wire_VideoCodecSettings {
+        fn new_with_null_ptr() -> Self {
+            Self {
+                codec: Default::default(),
+                complexity: Default::default(),
+            }
+        }
+    }
+
+    impl Default for wire_VideoCodecSettings {
+        fn default() -> Self {
+            Self::new_with_null_ptr()
+        }
+    }
+
     // Section: sync execution mode utility
 
     #[no_mangle]
@@ -1,6 +1,9 @@
 use std::{
     ptr,
-    sync::atomic::{AtomicPtr, Ordering},
+    sync::{
+        atomic::{AtomicPtr, Ordering},
+        mpsc,
+    },
 };
 
 #[cfg(target_os = "windows")]
@@ -96,7 +99,11 @@ impl DeviceState {
     }
 
     /// Counts current number of audio media devices.
+    ///
+    /// Only called once the audio devices may have changed, so re-enumerates
+    /// them.
     fn count_audio_devices(&mut self) -> u32 {
+        sys::invalidate_audio_device_cache();
         self.adm.playout_devices() + self.adm.recording_devices()
     }
 
@@ -117,6 +124,7 @@ impl DeviceState {
 
     /// Triggers the [`OnDeviceChangeCallback`].
     fn on_device_change(&mut self) {
+        sys::invalidate_audio_device_cache();
         self.cb.add(());
     }
 }
@@ -267,10 +275,15 @@ impl Webrtc {
         Ok(None)
     }
 
-    /// Sets the specified `audio playout` device.
+    /// Stops the playout and starts changing it to the specified
+    /// `audio playout` device, sending the result to the provided `tx`.
+    ///
+    /// The playout should be restarted via
+    /// [`Webrtc::restart_audio_playout()`] once the device is changed.
     pub fn set_audio_playout_device(
         &mut self,
         device_id: String,
+        tx: mpsc::Sender<anyhow::Result<()>>,
     ) -> anyhow::Result<()> {
         let device_id = AudioDeviceId::from(device_id);
         let index = self.get_index_of_audio_playout_device(&device_id)?;
@@ -278,20 +291,30 @@ impl Webrtc {
         if let Some(index) = index {
             let adm = &self.audio_device_module;
             adm.stop_playout()?;
-            adm.set_playout_device(index)?;
-            adm.stereo_playout_is_available(false)?;
-            adm.init_playout()?;
-            adm.start_playout()?;
+            adm.set_playout_device(index, tx);
             Ok(())
         } else {
             Err(anyhow!("Cannot find playout device with ID `{device_id}`"))
         }
     }
 
-    /// Sets the microphone system volume according to the specified `level` in
-    /// percents.
-    pub fn set_microphone_volume(&mut self, level: u8) -> anyhow::Result<()> {
-        self.audio_device_module.set_microphone_volume(level)
+    /// Restarts the playout stopped by the
+    /// [`Webrtc::set_audio_playout_device()`].
+    pub fn restart_audio_playout(&mut self) -> anyhow::Result<()> {
+        let adm = &self.audio_device_module;
+        adm.stereo_playout_is_available(false)?;
+        adm.init_playout()?;
+        adm.start_playout()
+    }
+
+    /// Starts setting the microphone system volume according to the specified
+    /// `level` in percents, sending the result to the provided `tx`.
+    pub fn set_microphone_volume(
+        &mut self,
+        level: u8,
+        tx: mpsc::Sender<anyhow::Result<()>>,
+    ) -> anyhow::Result<()> {
+        self.audio_device_module.set_microphone_volume(level, tx)
     }
 
     /// Indicates if the microphone is available to set volume.
@@ -304,6 +327,11 @@ impl Webrtc {
         self.audio_device_module.microphone_volume()
     }
 
+    /// Sets the number of 10 ms buffers kept queued for the audio playout.
+    pub fn set_playout_buffer_depth(&self, buffers: u16) -> anyhow::Result<()> {
+        self.audio_device_module.set_playout_buffer_depth(buffers)
+    }
+
     /// Sets the provided [`OnDeviceChangeCallback`] as the callback to be
     /// called whenever the set of available media devices changes.
     ///
@@ -345,7 +373,17 @@ pub unsafe fn init() {
 
     // Audio devices monitoring via PulseAudio.
     thread::spawn(move || {
-        let mut m = AudioMonitor::new().unwrap();
+        let mut m = match AudioMonitor::new() {
+            Ok(m) => m,
+            Err(e) => {
+                log::error!("Failed to start PulseAudio devices monitor: {e}");
+                return;
+            }
+        };
+
+        // Audio devices changes are tracked from now on, so their enumeration
+        // can be cached until the next change.
+        sys::enable_audio_device_cache();
         loop {
             match m.main_loop.iterate(true) {
                 IterateResult::Success(_) => {}
@@ -357,6 +395,7 @@ pub unsafe fn init() {
                 }
             }
         }
+        sys::disable_audio_device_cache();
     });
 }
 
@@ -549,6 +588,10 @@ pub unsafe fn init() {
     }
 
     set_on_device_change_mac(on_device_change);
+
+    // Audio devices changes are tracked from now on, so their enumeration can
+    // be cached until the next change.
+    sys::enable_audio_device_cache();
 }
 
 #[cfg(target_os = "windows")]
@@ -742,8 +785,16 @@ pub unsafe fn init() {
             None,
         );
 
+        if hwnd.0 == 0 {
+            log::error!("Failed to create devices notifier window");
+            return;
+        }
         ShowWindow(hwnd, SW_HIDE);
 
+        // Audio devices changes are tracked from now on, so their enumeration
+        // can be cached until the next change.
+        sys::enable_audio_device_cache();
+
         let mut msg: MSG = mem::zeroed();
 
         while GetMessageW(&mut msg, hwnd, 0, 0).into() {
@@ -754,5 +805,6 @@ pub unsafe fn init() {
             TranslateMessage(&msg);
             DispatchMessageW(&msg);
         }
+        sys::disable_audio_device_cache();
     });
 }
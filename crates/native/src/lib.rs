@@ -15,6 +15,7 @@ mod bridge_generated;
 mod devices;
 mod pc;
 mod renderer;
+mod stats;
 mod stream_sink;
 mod user_media;
 mod video_sink;
@@ -23,7 +24,7 @@ use std::{
     collections::HashMap,
     sync::{
         atomic::{AtomicU64, Ordering},
-        Arc,
+        Arc, Weak,
     },
 };
 
@@ -31,7 +32,10 @@ use dashmap::DashMap;
 use libwebrtc_sys as sys;
 use threadpool::ThreadPool;
 
-use crate::{user_media::TrackOrigin, video_sink::Id as VideoSinkId};
+use crate::{
+    pc::PeerConnectionId, user_media::TrackOrigin,
+    video_sink::Id as VideoSinkId,
+};
 
 #[doc(inline)]
 pub use crate::{
@@ -64,6 +68,10 @@ struct Webrtc {
     video_sinks: HashMap<VideoSinkId, VideoSink>,
     ap: sys::AudioProcessing,
 
+    /// [`PeerConnection`]s created by this [`Webrtc`], which haven't been
+    /// disposed yet.
+    peer_connections: HashMap<PeerConnectionId, Weak<PeerConnection>>,
+
     /// `peer_connection_factory` must be dropped before [`Thread`]s.
     peer_connection_factory: sys::PeerConnectionFactoryInterface,
     task_queue_factory: sys::TaskQueueFactory,
@@ -102,6 +110,7 @@ impl Webrtc {
                 Some(&signaling_thread),
                 Some(audio_device_module.as_ref()),
                 Some(&ap),
+                &api::apply_video_codec_config(),
             )?;
 
         Ok(Self {
@@ -117,6 +126,7 @@ impl Webrtc {
             audio_sources: HashMap::new(),
             audio_tracks: Arc::new(DashMap::new()),
             video_sinks: HashMap::new(),
+            peer_connections: HashMap::new(),
             callback_pool: ThreadPool::new(4),
         })
     }
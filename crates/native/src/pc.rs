@@ -38,7 +38,9 @@ impl Webrtc {
             configuration,
             self.callback_pool.clone(),
         )?;
-        let peer = RustOpaque::from(Arc::new(peer));
+        let peer = Arc::new(peer);
+        self.peer_connections.insert(id, Arc::downgrade(&peer));
+        let peer = RustOpaque::from(peer);
         obs.add(api::PeerConnectionEvent::PeerCreated { peer });
 
         Ok(())
@@ -76,15 +78,26 @@ impl Webrtc {
     /// If the [`Mutex`] guarding the [`sys::PeerConnectionInterface`] is
     /// poisoned.
     pub fn dispose_peer_connection(&mut self, this: &Arc<PeerConnection>) {
+        self.peer_connections.remove(&this.id);
+
         // Remove all tracks from this `Peer`'s senders.
+        let mut unsent = Vec::new();
         for mut track in self.video_tracks.iter_mut() {
-            track.senders.remove(this);
+            if track.senders.remove(this).is_some() {
+                unsent.push(track.key().clone());
+            }
         }
 
         for mut track in self.audio_tracks.iter_mut() {
             track.senders.remove(this);
         }
 
+        // Tracks not being sent anymore are constrained by their renderers
+        // again.
+        for (track_id, track_origin) in unsent {
+            self.update_video_sinks(&track_id, track_origin);
+        }
+
         let peer = this.inner.lock().unwrap();
 
         for trnscvr in peer.get_transceivers() {
@@ -117,6 +130,17 @@ impl Webrtc {
         peer.close();
     }
 
+    /// Returns all the [`PeerConnection`]s created by this [`Webrtc`], which
+    /// haven't been disposed or dropped yet.
+    pub fn peer_connections(&mut self) -> Vec<Arc<PeerConnection>> {
+        self.peer_connections
+            .retain(|_, peer| peer.strong_count() > 0);
+        self.peer_connections
+            .values()
+            .filter_map(Weak::upgrade)
+            .collect()
+    }
+
     /// Replaces the specified [`AudioTrack`] (or [`VideoTrack`]) on the
     /// [`sys::Transceiver`]'s `sender`.
     ///
@@ -132,6 +156,8 @@ impl Webrtc {
     ) -> anyhow::Result<()> {
         let track_origin = TrackOrigin::Local;
 
+        // IDs of the `VideoTrack`s detached from the `transceiver`.
+        let mut detached = Vec::new();
         match transceiver.media_type() {
             sys::MediaType::MEDIA_TYPE_VIDEO => {
                 for mut track in self.video_tracks.iter_mut() {
@@ -142,6 +168,7 @@ impl Webrtc {
                     }
                     if delete {
                         track.senders.remove(peer);
+                        detached.push(track.key().0.clone());
                     }
                 }
             }
@@ -160,6 +187,12 @@ impl Webrtc {
             _ => unreachable!(),
         }
 
+        // Renderers constraints apply again to the video sources, which are
+        // not sent anymore.
+        for track_id in &detached {
+            self.update_video_sinks(track_id, track_origin);
+        }
+
         let sender = transceiver.inner.lock().unwrap().sender();
         if let Some(track_id) = track_id {
             match transceiver.media_type() {
@@ -179,7 +212,15 @@ impl Webrtc {
                         .or_default()
                         .insert(Arc::clone(transceiver));
 
-                    sender.replace_video_track(Some(track.as_ref()))
+                    let result =
+                        sender.replace_video_track(Some(track.as_ref()));
+                    drop(track);
+
+                    // Lift renderers constraints from the video source, so
+                    // they don't affect the sent video.
+                    self.update_video_sinks(&track_id, track_origin);
+
+                    result
                 }
                 sys::MediaType::MEDIA_TYPE_AUDIO => {
                     let track_id = AudioTrackId::from(track_id);
@@ -556,6 +597,27 @@ impl PeerConnection {
         self.inner.lock().unwrap().get_stats(Box::new(cb));
     }
 
+    /// Returns [`RtcStats`] of the provided [`sys::RtcStatsTypes`] of the
+    /// senders and receivers of the tracks and transceivers (by their `mid`s)
+    /// with the provided `ids` only.
+    ///
+    /// # Panics
+    ///
+    /// If the [`Mutex`] guarding the [`sys::PeerConnectionInterface`] is
+    /// poisoned.
+    pub fn get_selected_stats(
+        &self,
+        ids: Vec<String>,
+        types: sys::RtcStatsTypes,
+        report_tx: mpsc::Sender<sys::RtcStatsReport>,
+    ) {
+        let cb = GetStatsCallback(report_tx);
+        self.inner
+            .lock()
+            .unwrap()
+            .get_selected_stats(ids, types, Box::new(cb));
+    }
+
     /// Tells the [`PeerConnection`] that ICE should be restarted.
     ///
     /// # Errors
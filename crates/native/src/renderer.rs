@@ -67,7 +67,7 @@ impl TextureEventNotifier {
     }
 
     /// Passes the provided [`sys::VideoFrame`] to Dart side events.
-    fn on_frame(&mut self, frame: &cxx::UniquePtr<sys::VideoFrame>) {
+    fn on_frame(&mut self, frame: &sys::VideoFrame) {
         let height = frame.height();
         let width = frame.width();
         let rotation = frame.rotation();
@@ -133,22 +133,40 @@ mod frame_handler {
             }
         }
 
-        /// Passes provided [`sys::VideoFrame`] to the C++ side listener.
-        pub fn on_frame(&mut self, frame: UniquePtr<sys::VideoFrame>) {
+        /// Passes provided [`sys::VideoFrame`] to the C++ side listener,
+        /// downscaled to fit the provided `max_pixel_count`.
+        ///
+        /// Pixel data isn't converted here. The C++ side publishes the
+        /// [`VideoFrame`] to its latest-wins frame slots, and converts it via
+        /// [`VideoFrame::get_abgr_bytes()`] at most once, when Flutter
+        /// acquires it for presentation. Frames replaced by newer ones before
+        /// that are dropped unconverted.
+        pub fn on_frame(
+            &mut self,
+            frame: sys::PooledVideoFrame,
+            max_pixel_count: i32,
+        ) {
             self.event_tx.on_frame(&frame);
-            self.inner.pin_mut().on_frame(VideoFrame::from(frame));
+            self.inner
+                .pin_mut()
+                .on_frame(VideoFrame::new(frame, max_pixel_count));
         }
     }
 
-    impl From<UniquePtr<sys::VideoFrame>> for VideoFrame {
+    impl VideoFrame {
+        /// Creates a new [`VideoFrame`] out of the provided
+        /// [`sys::VideoFrame`], downscaled to fit the provided
+        /// `max_pixel_count`.
         #[allow(clippy::cast_sign_loss)]
-        fn from(frame: UniquePtr<sys::VideoFrame>) -> Self {
+        fn new(frame: sys::PooledVideoFrame, max_pixel_count: i32) -> Self {
             let height = frame.height();
             let width = frame.width();
 
             assert!(height >= 0, "VideoFrame has a negative height");
             assert!(width >= 0, "VideoFrame has a negative width");
 
+            let (width, height) =
+                fit_to_pixel_count(width, height, max_pixel_count);
             let buffer_size = width * height * 4;
 
             Self {
@@ -156,14 +174,38 @@ mod frame_handler {
                 width: width as usize,
                 buffer_size: buffer_size as usize,
                 rotation: frame.rotation().repr,
-                frame: Box::new(Frame::from(Box::new(frame))),
+                frame: Box::new(Frame::from(frame)),
             }
         }
     }
 
+    /// Returns dimensions of a `width`x`height` frame downscaled to fit the
+    /// provided `max_pixel_count`, preserving its aspect ratio.
+    #[allow(
+        clippy::cast_possible_truncation,
+        clippy::cast_precision_loss,
+        clippy::cast_sign_loss
+    )]
+    fn fit_to_pixel_count(
+        width: i32,
+        height: i32,
+        max_pixel_count: i32,
+    ) -> (i32, i32) {
+        let pixel_count = i64::from(width) * i64::from(height);
+        if pixel_count <= i64::from(max_pixel_count) {
+            return (width, height);
+        }
+
+        let scale = (f64::from(max_pixel_count) / pixel_count as f64).sqrt();
+        // Keep dimensions even, so chroma planes are scaled evenly.
+        let scaled = |v: i32| (((f64::from(v) * scale) as i32) & !1).max(2);
+
+        (scaled(width), scaled(height))
+    }
+
     /// Wrapper around a [`sys::VideoFrame`] transferable via FFI.
     #[derive(From)]
-    pub struct Frame(Box<UniquePtr<sys::VideoFrame>>);
+    pub struct Frame(sys::PooledVideoFrame);
 
     #[cxx::bridge]
     mod cpp_api_bindings {
@@ -223,14 +265,23 @@ mod frame_handler {
     }
 
     impl cpp_api_bindings::VideoFrame {
-        /// Converts this [`api::VideoFrame`] pixel data to the `ABGR` scheme
-        /// and outputs the result to the provided `buffer`.
+        /// Converts this [`api::VideoFrame`] pixel data to the `ABGR` scheme,
+        /// scaled to its `width` and `height`, and outputs the result to the
+        /// provided `buffer`.
         ///
         /// # Safety
         ///
         /// The provided `buffer` must be a valid pointer.
+        #[allow(clippy::cast_possible_truncation, clippy::cast_possible_wrap)]
         pub unsafe fn get_abgr_bytes(&self, buffer: *mut u8) {
-            libwebrtc_sys::video_frame_to_abgr(self.frame.0.as_ref(), buffer);
+            libwebrtc_sys::video_frame_to_abgr_scaled(
+                &self.frame.0,
+                self.width as i32,
+                self.height as i32,
+                self.width as i32 * 4,
+                false,
+                buffer,
+            );
         }
     }
 }
@@ -241,7 +292,6 @@ mod frame_handler {
 ///
 /// cbindgen:ignore
 mod frame_handler {
-    use cxx::UniquePtr;
     use libwebrtc_sys as sys;
 
     use crate::{
@@ -279,7 +329,7 @@ mod frame_handler {
 
         /// Actual [`sys::VideoFrame`].
         #[allow(clippy::struct_field_names)]
-        pub frame: *mut sys::VideoFrame,
+        pub frame: *mut sys::PooledVideoFrame,
     }
 
     impl FrameHandler {
@@ -297,8 +347,15 @@ mod frame_handler {
         }
 
         /// Passes the provided [`sys::VideoFrame`] to the C side listener.
+        ///
+        /// The C side renderer doesn't support downscaling, so the
+        /// `max_pixel_count` is ignored.
         #[allow(clippy::cast_sign_loss, clippy::too_many_lines)]
-        pub fn on_frame(&mut self, frame: UniquePtr<sys::VideoFrame>) {
+        pub fn on_frame(
+            &mut self,
+            frame: sys::PooledVideoFrame,
+            _max_pixel_count: i32,
+        ) {
             let height = frame.height();
             let width = frame.width();
 
@@ -316,7 +373,7 @@ mod frame_handler {
                         width: width as usize,
                         buffer_size: buffer_size as usize,
                         rotation: frame.rotation().repr,
-                        frame: UniquePtr::into_raw(frame),
+                        frame: Box::into_raw(Box::new(frame)),
                     },
                 );
             }
@@ -339,7 +396,7 @@ mod frame_handler {
     /// The provided `buffer` must be a valid pointer.
     #[no_mangle]
     unsafe extern "C" fn get_argb_bytes(
-        frame: *mut sys::VideoFrame,
+        frame: *mut sys::PooledVideoFrame,
         argb_stride: i32,
         buffer: *mut u8,
     ) {
@@ -350,9 +407,10 @@ mod frame_handler {
         );
     }
 
-    /// Drops the provided [`sys::VideoFrame`].
+    /// Drops the provided [`sys::VideoFrame`], returning it back to its
+    /// [`sys::VideoFramePool`].
     #[no_mangle]
-    unsafe extern "C" fn drop_frame(frame: *mut sys::VideoFrame) {
-        UniquePtr::from_raw(frame);
+    unsafe extern "C" fn drop_frame(frame: *mut sys::PooledVideoFrame) {
+        drop(Box::from_raw(frame));
     }
 }
@@ -0,0 +1,436 @@
+use std::{
+    collections::HashMap,
+    mem,
+    sync::{mpsc, Arc, Condvar, Mutex, Once, Weak},
+    thread,
+    time::{Duration, Instant},
+};
+
+use libwebrtc_sys::{self as sys, RTCStatsColumn as Column};
+
+use crate::{
+    api::{self, RX_TIMEOUT},
+    stream_sink::StreamSink,
+    PeerConnection,
+};
+
+/// Subscriptions run by the [`run_subscriptions()`] thread.
+static SUBSCRIPTIONS: Mutex<Vec<Subscription>> = Mutex::new(Vec::new());
+
+/// [`Condvar`] waking up the [`run_subscriptions()`] thread once a new
+/// [`Subscription`] is added.
+static SUBSCRIPTIONS_WAKEUP: Condvar = Condvar::new();
+
+/// Spawns the [`run_subscriptions()`] thread on the first [`subscribe()`].
+static SUBSCRIPTIONS_THREAD: Once = Once::new();
+
+/// Starts a new subscription to the [`api::RtcStats`] of the provided `types`
+/// of the provided [`PeerConnection`], loading them every `interval`.
+///
+/// All the subscriptions are run by a single shared thread. A subscription
+/// ends once the `sink` is closed or the [`PeerConnection`] is dropped.
+///
+/// # Panics
+///
+/// If the [`Mutex`] guarding the [`SUBSCRIPTIONS`] is poisoned.
+pub fn subscribe(
+    peer: &Arc<PeerConnection>,
+    interval: Duration,
+    types: sys::RtcStatsTypes,
+    sink: StreamSink<api::RtcStatsUpdate>,
+) {
+    SUBSCRIPTIONS_THREAD.call_once(|| {
+        thread::spawn(run_subscriptions);
+    });
+
+    SUBSCRIPTIONS.lock().unwrap().push(Subscription {
+        peer: Arc::downgrade(peer),
+        interval,
+        types,
+        sink,
+        differ: StatsDiffer::default(),
+        deadline: Instant::now(),
+        pending: None,
+    });
+    SUBSCRIPTIONS_WAKEUP.notify_one();
+}
+
+/// Runs all the [`Subscription`]s, loading the reports of the due ones
+/// concurrently.
+///
+/// The due [`Subscription`]s are taken out of the [`SUBSCRIPTIONS`] while
+/// their reports are loaded, so adding new ones never waits for that.
+fn run_subscriptions() {
+    let mut subscriptions = SUBSCRIPTIONS.lock().unwrap();
+    loop {
+        let now = Instant::now();
+        let Some(next) = subscriptions.iter().map(|s| s.deadline).min() else {
+            subscriptions = SUBSCRIPTIONS_WAKEUP.wait(subscriptions).unwrap();
+            continue;
+        };
+        if next > now {
+            subscriptions = SUBSCRIPTIONS_WAKEUP
+                .wait_timeout(subscriptions, next - now)
+                .unwrap()
+                .0;
+            continue;
+        }
+
+        let (due, pending): (Vec<_>, Vec<_>) = mem::take(&mut *subscriptions)
+            .into_iter()
+            .partition(|s| s.deadline <= now);
+        *subscriptions = pending;
+        drop(subscriptions);
+
+        // All the reports are requested before waiting for any of them, while
+        // the subscriptions of the dropped `PeerConnection`s end here. A report
+        // still pending since the previous tick is awaited instead of
+        // requesting a new one.
+        let requests: Vec<_> = due
+            .into_iter()
+            .filter_map(|mut s| {
+                let peer = s.peer.upgrade()?;
+                let rx = s.pending.take().unwrap_or_else(|| {
+                    let (tx, rx) = mpsc::channel();
+                    peer.get_stats(tx);
+                    rx
+                });
+                Some((s, rx))
+            })
+            .collect();
+
+        // A stuck `PeerConnection` delays the others no longer than the
+        // shortest interval of the due subscriptions, while the already
+        // delivered reports don't wait for it at all.
+        let budget = requests
+            .iter()
+            .map(|(s, _)| s.interval)
+            .min()
+            .map_or(RX_TIMEOUT, |interval| interval.min(RX_TIMEOUT));
+        let deadline = Instant::now() + budget;
+        let (delivered, waiting): (Vec<_>, Vec<_>) = requests
+            .into_iter()
+            .map(|(s, rx)| {
+                let report = rx.try_recv();
+                (s, rx, report)
+            })
+            .partition(|(_, _, report)| report.is_ok());
+
+        let mut ticked = Vec::with_capacity(delivered.len() + waiting.len());
+        for (mut s, _, report) in delivered {
+            if s.tick(report.ok()) {
+                ticked.push(s);
+            }
+        }
+        for (mut s, rx, _) in waiting {
+            let timeout = deadline.saturating_duration_since(Instant::now());
+            let report = match rx.recv_timeout(timeout) {
+                Ok(report) => Some(report),
+                Err(mpsc::RecvTimeoutError::Timeout) => {
+                    s.pending = Some(rx);
+                    None
+                }
+                Err(e) => {
+                    log::warn!("Failed to load `RtcStats`: {e}");
+                    None
+                }
+            };
+            if s.tick(report) {
+                ticked.push(s);
+            }
+        }
+
+        subscriptions = SUBSCRIPTIONS.lock().unwrap();
+        subscriptions.extend(ticked);
+    }
+}
+
+/// Subscription to the [`api::RtcStats`] of a single [`PeerConnection`].
+struct Subscription {
+    /// [`PeerConnection`] to load the reports of.
+    ///
+    /// Only a weak reference is held, so the subscription doesn't prolong the
+    /// life of the [`PeerConnection`].
+    peer: Weak<PeerConnection>,
+
+    /// Interval between the reports.
+    interval: Duration,
+
+    /// Types of the [`api::RtcStats`] to diff.
+    types: sys::RtcStatsTypes,
+
+    /// [`StreamSink`] to send the [`api::RtcStatsUpdate`]s into.
+    sink: StreamSink<api::RtcStatsUpdate>,
+
+    /// [`StatsDiffer`] of the reports.
+    differ: StatsDiffer,
+
+    /// Time to load the next report at.
+    deadline: Instant,
+
+    /// Report requested, but not delivered in time on the previous tick.
+    pending: Option<mpsc::Receiver<sys::RtcStatsReport>>,
+}
+
+impl Subscription {
+    /// Diffs the provided `report`, if it's been delivered, and schedules the
+    /// next one.
+    ///
+    /// Returns `false` if the `sink` is closed, so this [`Subscription`] ends.
+    fn tick(&mut self, report: Option<sys::RtcStatsReport>) -> bool {
+        if let Some(report) = report {
+            match self.differ.update(&report, self.types) {
+                Ok(Some(update)) => {
+                    if !self.sink.add(update) {
+                        return false;
+                    }
+                }
+                Ok(None) => {}
+                Err(e) => log::warn!("Failed to diff `RtcStats`: {e}"),
+            }
+        }
+
+        // Deadlines are kept on the grid of the first one, so the time spent
+        // on loading the reports doesn't accumulate.
+        self.deadline += self.interval;
+        let now = Instant::now();
+        if self.deadline < now {
+            self.deadline = now;
+        }
+        true
+    }
+}
+
+/// Collects the [`api::RtcStats`] of the provided `types` of all the provided
+/// [`PeerConnection`]s at once.
+///
+/// Reports of all the [`PeerConnection`]s are requested before waiting for
+/// any of them, so their collection runs concurrently. The ones not delivered
+/// within the `budget` are marked as timed out.
+pub fn collect_batch(
+    peers: &[Arc<PeerConnection>],
+    types: sys::RtcStatsTypes,
+    budget: Duration,
+) -> api::RtcStatsBatch {
+    let started = Instant::now();
+    let deadline = started + budget;
+
+    let requests: Vec<_> = peers
+        .iter()
+        .map(|peer| {
+            let (tx, rx) = mpsc::channel();
+            peer.get_stats(tx);
+            (peer.id(), rx)
+        })
+        .collect();
+
+    let peers = requests
+        .into_iter()
+        .map(|(id, rx)| {
+            let timeout = deadline.saturating_duration_since(Instant::now());
+            let stats = rx.recv_timeout(timeout).ok().and_then(|report| {
+                report
+                    .get_filtered_stats(types)
+                    .map_err(|e| {
+                        log::warn!("Failed to load `RtcStats` of `{id}`: {e}");
+                    })
+                    .ok()
+            });
+
+            api::RtcPeerStats {
+                peer_id: id.into(),
+                timed_out: stats.is_none(),
+                stats: stats
+                    .unwrap_or_default()
+                    .into_iter()
+                    .map(api::RtcStats::from)
+                    .collect(),
+            }
+        })
+        .collect();
+
+    api::RtcStatsBatch {
+        peers,
+        elapsed_us: i64::try_from(started.elapsed().as_micros())
+            .unwrap_or(i64::MAX),
+    }
+}
+
+/// Values of a single [`api::RtcStats`] from the previous report.
+struct Snapshot {
+    /// Timestamp of the [`api::RtcStats`] in microseconds.
+    timestamp_us: i64,
+
+    /// Values of the numeric [`Column`]s by their indices, or [`f64::NAN`] if
+    /// absent.
+    numbers: Vec<f64>,
+
+    /// Values of the string [`Column`]s, starting from the [`Column::Kind`].
+    strings: Vec<Option<String>>,
+}
+
+impl Snapshot {
+    /// Creates a new [`Snapshot`] of the provided `row` of the `columns`.
+    fn new(columns: &sys::RtcStatsColumns, row: usize) -> Self {
+        let numbers = (0..Column::Kind.repr)
+            .map(|repr| columns.value(row, Column { repr }).unwrap_or(f64::NAN))
+            .collect();
+        let strings = (Column::Kind.repr
+            ..=Column::QualityLimitationReason.repr)
+            .map(|repr| columns.string(row, Column { repr }).map(str::to_owned))
+            .collect();
+
+        Self {
+            timestamp_us: columns.timestamp_us(row),
+            numbers,
+            strings,
+        }
+    }
+
+    /// Returns the value of the provided numeric [`Column`], if it's present.
+    fn number(&self, column: Column) -> Option<f64> {
+        self.numbers
+            .get(usize::from(column.repr))
+            .copied()
+            .filter(|v| !v.is_nan())
+    }
+
+    /// Indicates whether this [`Snapshot`] has the same values as the provided
+    /// one, regardless of their timestamps.
+    fn same_values(&self, other: &Self) -> bool {
+        self.strings == other.strings
+            && self.numbers.len() == other.numbers.len()
+            && self
+                .numbers
+                .iter()
+                .zip(&other.numbers)
+                .all(|(a, b)| a == b || (a.is_nan() && b.is_nan()))
+    }
+
+    /// Derives [`api::RtcStatsRates`] from the difference between the
+    /// provided previous [`Snapshot`] and this one.
+    #[allow(
+        clippy::cast_possible_truncation,
+        clippy::cast_precision_loss,
+        clippy::cast_sign_loss
+    )]
+    fn rates_since(&self, prev: &Self) -> api::RtcStatsRates {
+        let secs = (self.timestamp_us - prev.timestamp_us) as f64 / 1_000_000.0;
+        if secs <= 0.0 {
+            return api::RtcStatsRates::default();
+        }
+
+        let delta = |column| Some(self.number(column)? - prev.number(column)?);
+        let first_delta =
+            |columns: &[Column]| columns.iter().find_map(|c| delta(*c));
+
+        let packet_loss_percent = match (
+            delta(Column::PacketsLost),
+            delta(Column::PacketsReceived),
+        ) {
+            (Some(lost), Some(received)) if lost + received > 0.0 => {
+                Some(lost.max(0.0) / (lost + received) * 100.0)
+            }
+            _ => self.number(Column::FractionLost).map(|f| f * 100.0),
+        };
+
+        api::RtcStatsRates {
+            bitrate: first_delta(&[Column::BytesSent, Column::BytesReceived])
+                .map(|bytes| bytes * 8.0 / secs),
+            packet_rate: first_delta(&[
+                Column::PacketsSent,
+                Column::PacketsReceived,
+            ])
+            .map(|packets| packets / secs),
+            packet_loss_percent,
+            frame_rate: first_delta(&[
+                Column::FramesEncoded,
+                Column::FramesDecoded,
+                Column::Frames,
+            ])
+            .map(|frames| frames / secs),
+            jitter_trend: delta(Column::Jitter).map(|jitter| jitter / secs),
+            new_freezes: delta(Column::FreezeCount)
+                .map(|freezes| freezes.max(0.0) as u32),
+        }
+    }
+}
+
+/// Differ of consecutive reports of the same [`PeerConnection`].
+#[derive(Default)]
+struct StatsDiffer {
+    /// [`Snapshot`]s of the previous report and the [`api::RtcStatsRates`]
+    /// derived from them by the IDs of their [`api::RtcStats`].
+    prev: HashMap<String, (Snapshot, api::RtcStatsRates)>,
+}
+
+impl StatsDiffer {
+    /// Diffs the provided `report` with the previous one, returning an
+    /// [`api::RtcStatsUpdate`] if anything has changed.
+    ///
+    /// An [`api::RtcStats`] is changed if any of its values or any of its
+    /// derived [`api::RtcStatsRates`] differ, so a stalled stream is reported
+    /// once with its rates dropped to zero.
+    ///
+    /// Values are compared via [`sys::RtcStatsColumns`], so the
+    /// [`api::RtcStats`] are copied and built for the changed ones only.
+    fn update(
+        &mut self,
+        report: &sys::RtcStatsReport,
+        types: sys::RtcStatsTypes,
+    ) -> anyhow::Result<Option<api::RtcStatsUpdate>> {
+        let columns = report.get_columns(types);
+
+        let mut current = HashMap::with_capacity(columns.len());
+        let mut changed = Vec::new();
+        for row in 0..columns.len() {
+            let snapshot = Snapshot::new(&columns, row);
+            let id = columns.id(row);
+            let entry = match self.prev.remove(id) {
+                // The same `RtcStats` as previously, cached by `libwebrtc`.
+                Some((prev, rates))
+                    if snapshot.timestamp_us <= prev.timestamp_us =>
+                {
+                    (prev, rates)
+                }
+                Some((prev, prev_rates)) => {
+                    let rates = snapshot.rates_since(&prev);
+                    if rates != prev_rates || !prev.same_values(&snapshot) {
+                        changed.push((id.to_owned(), rates));
+                    }
+                    (snapshot, rates)
+                }
+                None => {
+                    let rates = api::RtcStatsRates::default();
+                    changed.push((id.to_owned(), rates));
+                    (snapshot, rates)
+                }
+            };
+            current.insert(id.to_owned(), entry);
+        }
+
+        let removed: Vec<_> =
+            mem::replace(&mut self.prev, current).into_keys().collect();
+
+        if changed.is_empty() && removed.is_empty() {
+            return Ok(None);
+        }
+
+        // Only the changed `RtcStats` are copied out of the report.
+        let ids: Vec<_> = changed.iter().map(|(id, _)| id.clone()).collect();
+        let mut changed: HashMap<_, _> = changed.into_iter().collect();
+        let changed = report
+            .get_stats_by_ids(&ids)?
+            .into_iter()
+            .filter_map(|stats| {
+                let rates = changed.remove(&stats.id)?;
+                Some(api::RtcStatsDelta {
+                    stats: stats.into(),
+                    rates,
+                })
+            })
+            .collect();
+
+        Ok(Some(api::RtcStatsUpdate { changed, removed }))
+    }
+}
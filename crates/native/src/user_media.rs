@@ -1,7 +1,7 @@
 use std::{
     collections::{HashMap, HashSet},
     hash::Hash,
-    sync::{Arc, RwLock, Weak},
+    sync::{mpsc, Arc, RwLock, Weak},
 };
 
 use anyhow::{anyhow, bail, Context};
@@ -18,6 +18,12 @@ use crate::{
     PeerConnection, VideoSink, VideoSinkId, Webrtc,
 };
 
+/// Default maximum share of a single CPU core a screen capturer may spend on
+/// capturing and converting frames, in percents.
+///
+/// Used if no [`api::VideoConstraints::cpu_budget_percentage`] is provided.
+const DEFAULT_DISPLAY_CAPTURE_CPU_BUDGET_PERCENTAGE: u8 = 50;
+
 impl Webrtc {
     /// Creates a new [`VideoTrack`]s and/or [`AudioTrack`]s according to the
     /// provided accepted [`api::MediaStreamConstraints`].
@@ -295,10 +301,15 @@ impl Webrtc {
         } else {
             let src = Arc::new(AudioSource(
                 device_id.clone(),
-                Arc::new(
-                    self.audio_device_module
-                        .create_audio_source(device_index)?,
-                ),
+                Arc::new(self.audio_device_module.create_audio_source(
+                    device_index,
+                    sys::AudioProcessingOptions {
+                        echo_cancellation: caps.echo_cancellation,
+                        noise_suppression: caps.noise_suppression,
+                        auto_gain_control: caps.auto_gain_control,
+                        high_pass_filter: caps.high_pass_filter,
+                    },
+                )?),
             ));
             self.audio_sources.insert(device_id, Arc::clone(&src));
 
@@ -769,7 +780,8 @@ impl AudioDeviceModule {
     }
 
     /// Creates a new [`sys::AudioSourceInterface`] based on the provided
-    /// `device_index`.
+    /// `device_index`, processing the recorded audio according to the
+    /// provided [`sys::AudioProcessingOptions`].
     ///
     /// # Errors
     ///
@@ -777,11 +789,17 @@ impl AudioDeviceModule {
     pub fn create_audio_source(
         &mut self,
         device_index: u16,
+        processing: sys::AudioProcessingOptions,
     ) -> anyhow::Result<sys::AudioSourceInterface> {
         if api::is_fake_media() {
-            self.inner.create_fake_audio_source()
+            self.inner
+                .create_fake_audio_source(&api::fake_media_options().into())
         } else {
-            self.inner.create_audio_source(device_index)
+            self.inner.create_audio_source(
+                device_index,
+                sys::AudioCaptureFormat::default(),
+                processing,
+            )
         }
     }
 
@@ -792,14 +810,20 @@ impl AudioDeviceModule {
     /// Sets the microphone system volume according to the given level in
     /// percents.
     ///
+    /// The volume is set asynchronously, and its result is sent to the
+    /// provided `tx`.
+    ///
     /// # Errors
     ///
     /// Errors if any of the following calls fail:
     ///     - [`sys::AudioDeviceModule::microphone_volume_is_available()`];
     ///     - [`sys::AudioDeviceModule::min_microphone_volume()`];
-    ///     - [`sys::AudioDeviceModule::max_microphone_volume()`];
-    ///     - [`sys::AudioDeviceModule::set_microphone_volume()`].
-    pub fn set_microphone_volume(&self, mut level: u8) -> anyhow::Result<()> {
+    ///     - [`sys::AudioDeviceModule::max_microphone_volume()`].
+    pub fn set_microphone_volume(
+        &self,
+        mut level: u8,
+        tx: mpsc::Sender<anyhow::Result<()>>,
+    ) -> anyhow::Result<()> {
         if !self.microphone_volume_is_available()? {
             bail!("The microphone volume is unavailable.")
         }
@@ -815,7 +839,12 @@ impl AudioDeviceModule {
             + (f64::from(max_volume - min_volume) * (f64::from(level) / 100.0));
 
         #[allow(clippy::cast_possible_truncation, clippy::cast_sign_loss)]
-        self.inner.set_microphone_volume(volume as u32)
+        self.inner.set_microphone_volume_async(
+            volume as u32,
+            Box::new(AudioDeviceModuleCallback::new("SetMicrophoneVolume", tx)),
+        );
+
+        Ok(())
     }
 
     /// Indicates if the microphone is available to set volume.
@@ -859,13 +888,17 @@ impl AudioDeviceModule {
 
     /// Changes the playout device for this [`AudioDeviceModule`].
     ///
-    /// # Errors
-    ///
-    /// If [`sys::AudioDeviceModule::set_playout_device()`] call fails.
-    pub fn set_playout_device(&self, index: u16) -> anyhow::Result<()> {
-        self.inner.set_playout_device(index)?;
-
-        Ok(())
+    /// The device is changed asynchronously, and its result is sent to the
+    /// provided `tx`.
+    pub fn set_playout_device(
+        &self,
+        index: u16,
+        tx: mpsc::Sender<anyhow::Result<()>>,
+    ) {
+        self.inner.set_playout_device_async(
+            index,
+            Box::new(AudioDeviceModuleCallback::new("SetPlayoutDevice", tx)),
+        );
     }
 
     /// Stops playout of audio on this [`AudioDeviceModule`].
@@ -906,6 +939,16 @@ impl AudioDeviceModule {
     pub fn start_playout(&self) -> anyhow::Result<()> {
         self.inner.start_playout()
     }
+
+    /// Sets the number of 10 ms buffers kept queued for playout by this
+    /// [`AudioDeviceModule`].
+    ///
+    /// # Errors
+    ///
+    /// If [`sys::AudioDeviceModule::set_playout_buffer_depth()`] call fails.
+    pub fn set_playout_buffer_depth(&self, buffers: u16) -> anyhow::Result<()> {
+        self.inner.set_playout_buffer_depth(buffers)
+    }
 }
 
 /// Indicates whether some track is a local track obtained via
@@ -981,7 +1024,7 @@ struct VideoFormatSink {
 }
 
 impl OnFrameCallback for VideoFormatSink {
-    fn on_frame(&mut self, frame: cxx::UniquePtr<sys::VideoFrame>) {
+    fn on_frame(&mut self, frame: &sys::VideoFrame) {
         if self.width.get().is_none() {
             self.width.set(RwLock::from(frame.width())).unwrap();
             self.height.set(RwLock::from(frame.height())).unwrap();
@@ -1086,10 +1129,33 @@ impl VideoTrack {
 
     /// Adds the provided [`VideoSink`] to this [`VideoTrack`].
     pub fn add_video_sink(&mut self, video_sink: &mut VideoSink) {
-        self.inner.add_or_update_sink(video_sink.as_mut());
+        self.update_video_sink(video_sink);
         self.sinks.push(video_sink.id());
     }
 
+    /// Registers the provided [`VideoSink`] in the underlying
+    /// [`sys::VideoTrackInterface`] with its actual [`sys::VideoSinkWants`].
+    ///
+    /// [`sys::VideoSinkWants`] are ignored for local [`VideoTrack`]s being
+    /// sent, since a video source adapts to its most restrictive sink, so the
+    /// sent video would be degraded to the rendered size.
+    pub fn update_video_sink(&self, video_sink: &mut VideoSink) {
+        let wants = if self.track_origin == TrackOrigin::Local
+            && !self.senders.is_empty()
+        {
+            sys::VideoSinkWants::default()
+        } else {
+            video_sink.wants()
+        };
+        self.inner.add_or_update_sink(video_sink.as_mut(), &wants);
+    }
+
+    /// Returns IDs of the [`VideoSink`]s attached to this [`VideoTrack`].
+    #[must_use]
+    pub fn sinks(&self) -> &[VideoSinkId] {
+        &self.sinks
+    }
+
     /// Detaches the provided [`VideoSink`] from this [`VideoTrack`].
     pub fn remove_video_sink(&mut self, mut video_sink: VideoSink) {
         self.sinks.retain(|&sink| sink != video_sink.id());
@@ -1270,12 +1336,15 @@ impl VideoSource {
         device_id: VideoDeviceId,
     ) -> anyhow::Result<Self> {
         let inner = if api::is_fake_media() {
+            let options = api::fake_media_options();
             sys::VideoTrackSourceInterface::create_fake(
                 worker_thread,
                 signaling_thread,
                 caps.width as usize,
                 caps.height as usize,
                 caps.frame_rate as usize,
+                options.video_content.into(),
+                options.video_overlay,
             )
         } else {
             sys::VideoTrackSourceInterface::create_proxy_from_device(
@@ -1303,12 +1372,15 @@ impl VideoSource {
         device_id: VideoDeviceId,
     ) -> anyhow::Result<Self> {
         let inner = if api::is_fake_media() {
+            let options = api::fake_media_options();
             sys::VideoTrackSourceInterface::create_fake(
                 worker_thread,
                 signaling_thread,
                 caps.width as usize,
                 caps.height as usize,
                 caps.frame_rate as usize,
+                options.video_content.into(),
+                options.video_overlay,
             )?
         } else {
             sys::VideoTrackSourceInterface::create_proxy_from_display(
@@ -1318,6 +1390,8 @@ impl VideoSource {
                 caps.width as usize,
                 caps.height as usize,
                 caps.frame_rate as usize,
+                caps.cpu_budget_percentage
+                    .unwrap_or(DEFAULT_DISPLAY_CAPTURE_CPU_BUDGET_PERCENTAGE),
             )?
         };
         Ok(Self { inner, device_id })
@@ -1333,3 +1407,36 @@ impl sys::TrackEventCallback for TrackEventHandler {
         self.0.add(api::TrackEvent::Ended);
     }
 }
+
+/// [`sys::AudioDeviceModuleCallback`] sending the result of an asynchronous
+/// [`sys::AudioDeviceModule`] call to the provided [`mpsc::Sender`].
+struct AudioDeviceModuleCallback {
+    /// Name of the called [`sys::AudioDeviceModule`] method.
+    method: &'static str,
+
+    /// [`mpsc::Sender`] to send the result of the call to.
+    tx: mpsc::Sender<anyhow::Result<()>>,
+}
+
+impl AudioDeviceModuleCallback {
+    /// Creates a new [`AudioDeviceModuleCallback`] of the provided `method`.
+    fn new(method: &'static str, tx: mpsc::Sender<anyhow::Result<()>>) -> Self {
+        Self { method, tx }
+    }
+}
+
+impl sys::AudioDeviceModuleCallback for AudioDeviceModuleCallback {
+    fn on_done(&mut self, result: i32) {
+        let result = if result == 0 {
+            Ok(())
+        } else {
+            Err(anyhow!(
+                "`AudioDeviceModule::{}()` failed with `{result}` code",
+                self.method,
+            ))
+        };
+        if let Err(e) = self.tx.send(result) {
+            log::warn!("Failed to complete `AudioDeviceModuleCallback`: {e}");
+        }
+    }
+}
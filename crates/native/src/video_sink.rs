@@ -1,5 +1,9 @@
+use std::{
+    sync::{Arc, Mutex},
+    time::{Duration, Instant},
+};
+
 use anyhow::anyhow;
-use cxx::UniquePtr;
 use derive_more::{AsMut, AsRef};
 use libwebrtc_sys as sys;
 
@@ -19,13 +23,20 @@ impl Webrtc {
         self.dispose_video_sink(sink_id);
 
         let track_id = VideoTrackId::from(track_id);
+        let wants = Arc::new(Mutex::new(sys::VideoSinkWants::default()));
         let mut sink = VideoSink {
             id: Id(sink_id),
             inner: sys::VideoSinkInterface::create_forwarding(Box::new(
-                OnFrameCallback(handler),
+                OnFrameCallback {
+                    handler,
+                    pool: sys::VideoFramePool::new(),
+                    wants: Arc::clone(&wants),
+                    last_frame_at: None,
+                },
             )),
             track_id: track_id.clone(),
             track_origin,
+            wants,
         };
 
         let mut track = self
@@ -39,6 +50,59 @@ impl Webrtc {
         Ok(())
     }
 
+    /// Sets the size (in physical pixels) the [`VideoSink`] with the provided
+    /// ID is rendered at, and the maximum framerate it should be rendered
+    /// with.
+    ///
+    /// The resulting [`sys::VideoSinkWants`] are propagated to the video
+    /// source, and [`VideoFrame`]s exceeding them are downscaled or dropped
+    /// before being rendered.
+    ///
+    /// Zero values mean no constraint.
+    ///
+    /// [`VideoFrame`]: sys::VideoFrame
+    pub fn set_video_sink_wants(
+        &mut self,
+        sink_id: i64,
+        max_width: i32,
+        max_height: i32,
+        max_fps: i32,
+    ) -> anyhow::Result<()> {
+        let sink = self
+            .video_sinks
+            .get_mut(&Id(sink_id))
+            .ok_or_else(|| anyhow!("Cannot find sink with ID `{sink_id}`"))?;
+        sink.set_wants(render_wants(max_width, max_height, max_fps));
+
+        let track = self
+            .video_tracks
+            .get(&(sink.track_id.clone(), sink.track_origin))
+            .ok_or_else(|| {
+                anyhow!("Cannot find track with ID `{}`", sink.track_id)
+            })?;
+        track.update_video_sink(sink);
+
+        Ok(())
+    }
+
+    /// Re-registers all the [`VideoSink`]s of the specified [`VideoTrack`], so
+    /// their [`sys::VideoSinkWants`] follow its current sending state.
+    pub fn update_video_sinks(
+        &mut self,
+        track_id: &VideoTrackId,
+        track_origin: TrackOrigin,
+    ) {
+        if let Some(track) =
+            self.video_tracks.get(&(track_id.clone(), track_origin))
+        {
+            for sink_id in track.sinks() {
+                if let Some(sink) = self.video_sinks.get_mut(sink_id) {
+                    track.update_video_sink(sink);
+                }
+            }
+        }
+    }
+
     /// Destroys a [`VideoSink`] by the given ID.
     pub fn dispose_video_sink(&mut self, sink_id: i64) {
         if let Some(sink) = self.video_sinks.remove(&Id(sink_id)) {
@@ -73,6 +137,10 @@ pub struct VideoSink {
     /// Origin (local or remote) of the [`VideoTrack`] attached to this
     /// [`VideoSink`].
     track_origin: TrackOrigin,
+
+    /// [`sys::VideoSinkWants`] of this [`VideoSink`], shared with its
+    /// [`OnFrameCallback`].
+    wants: Arc<Mutex<sys::VideoSinkWants>>,
 }
 
 impl VideoSink {
@@ -89,6 +157,7 @@ impl VideoSink {
             inner: sink,
             track_id,
             track_origin,
+            wants: Arc::default(),
         }
     }
 
@@ -97,14 +166,86 @@ impl VideoSink {
     pub fn id(&self) -> Id {
         self.id
     }
+
+    /// Returns the [`sys::VideoSinkWants`] of this [`VideoSink`].
+    #[must_use]
+    pub fn wants(&self) -> sys::VideoSinkWants {
+        *self.wants.lock().unwrap()
+    }
+
+    /// Sets the [`sys::VideoSinkWants`] of this [`VideoSink`].
+    fn set_wants(&mut self, wants: sys::VideoSinkWants) {
+        *self.wants.lock().unwrap() = wants;
+    }
+}
+
+/// Builds [`sys::VideoSinkWants`] for a renderer of the provided size and
+/// maximum framerate.
+///
+/// Zero values mean no constraint.
+fn render_wants(
+    max_width: i32,
+    max_height: i32,
+    max_fps: i32,
+) -> sys::VideoSinkWants {
+    let mut wants = sys::VideoSinkWants::default();
+    if max_width > 0 && max_height > 0 {
+        wants.max_pixel_count = max_width.saturating_mul(max_height);
+        // Chroma planes of I420 frames are subsampled in both dimensions, so
+        // odd sizes would have to be padded.
+        wants.resolution_alignment = 2;
+    }
+    if max_fps > 0 {
+        wants.max_framerate_fps = max_fps;
+    }
+    wants
 }
 
 /// Wrapper around an [`internal::OnFrameCallbackInterface`] implementing the
 /// required interfaces.
-struct OnFrameCallback(FrameHandler);
+struct OnFrameCallback {
+    /// [`FrameHandler`] the received [`sys::VideoFrame`]s are passed to.
+    handler: FrameHandler,
+
+    /// [`sys::VideoFramePool`] the received [`sys::VideoFrame`]s are retained
+    /// with.
+    pool: sys::VideoFramePool,
+
+    /// [`sys::VideoSinkWants`] of the [`VideoSink`] owning this
+    /// [`OnFrameCallback`].
+    wants: Arc<Mutex<sys::VideoSinkWants>>,
+
+    /// Time when the last [`sys::VideoFrame`] was passed to the `handler`.
+    last_frame_at: Option<Instant>,
+}
+
+impl OnFrameCallback {
+    /// Indicates whether a [`sys::VideoFrame`] received now should be dropped
+    /// to keep the provided maximum framerate.
+    fn exceeds_framerate(&mut self, max_framerate_fps: i32) -> bool {
+        let now = Instant::now();
+        if let (Some(last), 1..) = (self.last_frame_at, max_framerate_fps) {
+            // Leave some slack for the jitter of frames arrival.
+            let min_interval =
+                Duration::from_secs_f64(0.9 / f64::from(max_framerate_fps));
+            if now.duration_since(last) < min_interval {
+                return true;
+            }
+        }
+        self.last_frame_at = Some(now);
+
+        false
+    }
+}
 
 impl libwebrtc_sys::OnFrameCallback for OnFrameCallback {
-    fn on_frame(&mut self, frame: UniquePtr<sys::VideoFrame>) {
-        self.0.on_frame(frame);
+    fn on_frame(&mut self, frame: &sys::VideoFrame) {
+        let wants = *self.wants.lock().unwrap();
+        if self.exceeds_framerate(wants.max_framerate_fps) {
+            return;
+        }
+
+        self.handler
+            .on_frame(self.pool.acquire(frame), wants.max_pixel_count);
     }
 }
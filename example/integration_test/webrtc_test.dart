@@ -1144,4 +1144,131 @@ void main() {
     await tVideo.dispose();
     await tAudio.dispose();
   });
+
+  testWidgets('Peer connection get filtered stats.',
+      (WidgetTester tester) async {
+    // TODO: Support filtered stats for mobile platforms.
+    if (Platform.isAndroid || Platform.isIOS) {
+      return;
+    }
+    var pc1 = await PeerConnection.create(IceTransportType.all, []);
+    var pc2 = await PeerConnection.create(IceTransportType.all, []);
+
+    var tVideo = await pc1.addTransceiver(
+        MediaKind.video, RtpTransceiverInit(TransceiverDirection.sendRecv));
+    var tAudio = await pc1.addTransceiver(
+        MediaKind.audio, RtpTransceiverInit(TransceiverDirection.sendRecv));
+
+    var offer = await pc1.createOffer();
+    await pc1.setLocalDescription(offer);
+    await pc2.setRemoteDescription(offer);
+
+    var answer = await pc2.createAnswer();
+    await pc2.setLocalDescription(answer);
+    await pc1.setRemoteDescription(answer);
+
+    var outbound = await pc1.getStatsFiltered(RtcStatsTypeMask.outboundRtp);
+    expect(outbound.length, 2);
+    expect(outbound.every((e) => e.type is RtcOutboundRtpStreamStats), isTrue);
+
+    var transport = await pc1.getStatsFiltered(RtcStatsTypeMask.transport);
+    expect(transport.length, 1);
+    expect(transport.single.type is RtcTransportStats, isTrue);
+
+    var videoOnly = await pc1
+        .getStatsFiltered(RtcStatsTypeMask.outboundRtp, ids: [tVideo.mid!]);
+    expect(videoOnly.length, 1);
+    expect(
+        (videoOnly.single.type as RtcOutboundRtpStreamStats).mediaType
+            is RtcOutboundRtpStreamStatsVideo,
+        isTrue);
+
+    await pc1.close();
+    await pc2.close();
+    await tVideo.dispose();
+    await tAudio.dispose();
+  });
+
+  testWidgets('Peer connection subscribe stats.', (WidgetTester tester) async {
+    // TODO: Support stats subscriptions for mobile platforms.
+    if (Platform.isAndroid || Platform.isIOS) {
+      return;
+    }
+    var pc1 = await PeerConnection.create(IceTransportType.all, []);
+    var pc2 = await PeerConnection.create(IceTransportType.all, []);
+
+    var tVideo = await pc1.addTransceiver(
+        MediaKind.video, RtpTransceiverInit(TransceiverDirection.sendRecv));
+    var tAudio = await pc1.addTransceiver(
+        MediaKind.audio, RtpTransceiverInit(TransceiverDirection.sendRecv));
+
+    var offer = await pc1.createOffer();
+    await pc1.setLocalDescription(offer);
+    await pc2.setRemoteDescription(offer);
+
+    var answer = await pc2.createAnswer();
+    await pc2.setLocalDescription(answer);
+    await pc1.setRemoteDescription(answer);
+
+    var update = await pc1
+        .subscribeStats(const Duration(milliseconds: 100),
+            RtcStatsTypeMask.outboundRtp | RtcStatsTypeMask.transport)
+        .first
+        .timeout(const Duration(seconds: 5));
+
+    expect(update.removed, isEmpty);
+    expect(
+        update.changed
+            .where((e) => e.stats.type is RtcOutboundRtpStreamStats)
+            .length,
+        2);
+    expect(
+        update.changed.where((e) => e.stats.type is RtcTransportStats).length,
+        1);
+    expect(update.changed.length, 3);
+
+    await pc1.close();
+    await pc2.close();
+    await tVideo.dispose();
+    await tAudio.dispose();
+  });
+
+  testWidgets('Get all peers stats.', (WidgetTester tester) async {
+    // TODO: Support batched stats for mobile platforms.
+    if (Platform.isAndroid || Platform.isIOS) {
+      return;
+    }
+    var pc1 = await PeerConnection.create(IceTransportType.all, []);
+    var pc2 = await PeerConnection.create(IceTransportType.all, []);
+
+    var tVideo = await pc1.addTransceiver(
+        MediaKind.video, RtpTransceiverInit(TransceiverDirection.sendRecv));
+    var tAudio = await pc1.addTransceiver(
+        MediaKind.audio, RtpTransceiverInit(TransceiverDirection.sendRecv));
+
+    var offer = await pc1.createOffer();
+    await pc1.setLocalDescription(offer);
+    await pc2.setRemoteDescription(offer);
+
+    var answer = await pc2.createAnswer();
+    await pc2.setLocalDescription(answer);
+    await pc1.setRemoteDescription(answer);
+
+    var batch = await PeerConnection.getAllStats(
+        RtcStatsTypeMask.outboundRtp, const Duration(seconds: 1));
+
+    expect(batch.peers.length, greaterThanOrEqualTo(2));
+    expect(batch.peers.any((p) => p.timedOut), isFalse);
+    expect(
+        batch.peers.every((p) =>
+            p.stats.every((e) => e.type is RtcOutboundRtpStreamStats)),
+        isTrue);
+    expect(batch.peers.map((p) => p.stats.length).reduce((a, b) => a + b),
+        greaterThanOrEqualTo(2));
+
+    await pc1.close();
+    await pc2.close();
+    await tVideo.dispose();
+    await tAudio.dispose();
+  });
 }
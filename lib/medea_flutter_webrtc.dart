@@ -9,7 +9,8 @@ export 'src/api/parameters.dart' if (dart.library.html) 'none.dart';
 export 'src/api/send_encoding_parameters.dart'
     if (dart.library.html) 'none.dart';
 export 'src/model/constraints.dart' if (dart.library.html) 'none.dart';
-export 'src/model/constraints.dart' show FacingMode;
+export 'src/model/constraints.dart'
+    show FacingMode, FakeAudioSignal, FakeVideoContent;
 export 'src/model/device.dart' if (dart.library.html) 'none.dart';
 export 'src/model/ice.dart' if (dart.library.html) 'none.dart';
 export 'src/model/peer.dart' if (dart.library.html) 'none.dart';
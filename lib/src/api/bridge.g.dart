@@ -15,18 +15,34 @@ part 'bridge.g.freezed.dart';
 
 abstract class MedeaFlutterWebrtcNative {
   /// Returns all [`VideoCodecInfo`]s of the supported video encoders.
+  ///
+  /// Only the [`VideoCodec`]s enabled by the [`VideoCodecConfig`] are returned,
+  /// in its preference order.
   Future<List<VideoCodecInfo>> videoEncoders({dynamic hint});
 
   FlutterRustBridgeTaskConstMeta get kVideoEncodersConstMeta;
 
   /// Returns all [`VideoCodecInfo`]s of the supported video decoders.
+  ///
+  /// Only the [`VideoCodec`]s enabled by the [`VideoCodecConfig`] are returned,
+  /// in its preference order.
   Future<List<VideoCodecInfo>> videoDecoders({dynamic hint});
 
   FlutterRustBridgeTaskConstMeta get kVideoDecodersConstMeta;
 
+  /// Sets the [`VideoCodecConfig`] of all the [`PeerConnection`]s.
+  ///
+  /// The config is applied on creation of the underlying peer connection
+  /// factory, so this must be called before any other function to work.
+  Future<void> setVideoCodecConfig(
+      {required VideoCodecConfig config, dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kSetVideoCodecConfigConstMeta;
+
   /// Configures media acquisition to use fake devices instead of actual camera
-  /// and microphone.
-  Future<void> enableFakeMedia({dynamic hint});
+  /// and microphone, producing the media of the provided [`FakeMediaOptions`].
+  Future<void> enableFakeMedia(
+      {required FakeMediaOptions options, dynamic hint});
 
   FlutterRustBridgeTaskConstMeta get kEnableFakeMediaConstMeta;
 
@@ -35,6 +51,20 @@ abstract class MedeaFlutterWebrtcNative {
 
   FlutterRustBridgeTaskConstMeta get kIsFakeMediaConstMeta;
 
+  /// Returns the [`I420BufferPoolStats`] of all the screen capturers and fake
+  /// video sources.
+  Future<I420BufferPoolStats> i420BufferPoolStats({dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kI420BufferPoolStatsConstMeta;
+
+  /// Sets the maximum number of buffers kept by the pool of every screen
+  /// capturer and fake video source.
+  ///
+  /// Zero disables the recycling, so every frame is allocated anew.
+  Future<void> setI420BufferPoolDepth({required int depth, dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kSetI420BufferPoolDepthConstMeta;
+
   /// Returns a list of all available media input and output devices, such as
   /// microphones, cameras, headsets, and so forth.
   Future<List<MediaDeviceInfo>> enumerateDevices({dynamic hint});
@@ -156,6 +186,52 @@ abstract class MedeaFlutterWebrtcNative {
 
   FlutterRustBridgeTaskConstMeta get kGetPeerStatsConstMeta;
 
+  /// Returns [`RtcStats`] of the [`PeerConnection`] of the provided types only,
+  /// optionally limited to the provided tracks and transceivers.
+  ///
+  /// `type_mask` bit `n` selects the [`RtcStatsType`] variant with index `n` (in
+  /// the declaration order), so `0x04` selects the outbound RTP streams only.
+  ///
+  /// If `ids` are not empty, only the stats of the tracks and transceivers (by
+  /// their `mid`s) with these IDs are collected, via the selector-based
+  /// `getStats()`.
+  Future<List<RtcStats>> getPeerStatsFiltered(
+      {required ArcPeerConnection peer,
+      required int typeMask,
+      required List<String> ids,
+      dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kGetPeerStatsFilteredConstMeta;
+
+  /// Returns [`RtcStats`] of the provided types of all the [`PeerConnection`]s
+  /// at once.
+  ///
+  /// `type_mask` is the same as in the [`get_peer_stats_filtered()`]. Stats of
+  /// all the [`PeerConnection`]s are collected concurrently, waiting no longer
+  /// than `budget_ms` in total, so the ones not collected by then are marked as
+  /// timed out.
+  Future<RtcStatsBatch> getAllPeersStats(
+      {required int typeMask, required int budgetMs, dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kGetAllPeersStatsConstMeta;
+
+  /// Subscribes to the changes of the [`RtcStats`] of the [`PeerConnection`].
+  ///
+  /// Every `interval_ms` the [`RtcStats`] of the types in the `type_mask` (see
+  /// [`get_peer_stats_filtered()`]) are loaded, and an [`RtcStatsUpdate`] with
+  /// the changed ones only is sent, unless nothing has changed. The first update
+  /// contains all the [`RtcStats`].
+  ///
+  /// The subscription ends once the returned stream is cancelled or the
+  /// [`PeerConnection`] is dropped.
+  Stream<RtcStatsUpdate> subscribePeerStats(
+      {required ArcPeerConnection peer,
+      required int intervalMs,
+      required int typeMask,
+      dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kSubscribePeerStatsConstMeta;
+
   /// Irreversibly marks the specified [`RtcRtpTransceiver`] as stopping, unless
   /// it's already stopped.
   ///
@@ -241,6 +317,14 @@ abstract class MedeaFlutterWebrtcNative {
 
   FlutterRustBridgeTaskConstMeta get kMicrophoneVolumeConstMeta;
 
+  /// Sets the number of 10 ms buffers kept queued for the audio playout, trading
+  /// the playout latency against the risk of underruns.
+  ///
+  /// Restarts the playout if it's active already.
+  Future<void> setPlayoutBufferDepth({required int buffers, dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kSetPlayoutBufferDepthConstMeta;
+
   /// Disposes the specified [`MediaStreamTrack`].
   Future<void> disposeTrack(
       {required String trackId,
@@ -348,6 +432,20 @@ abstract class MedeaFlutterWebrtcNative {
 
   FlutterRustBridgeTaskConstMeta get kDisposeVideoSinkConstMeta;
 
+  /// Sets the size (in physical pixels) the [`VideoSink`] with the provided ID
+  /// is rendered at, and the maximum framerate it should be rendered with, so
+  /// the video is adapted accordingly.
+  ///
+  /// Zero values mean no constraint.
+  Future<void> setVideoSinkWants(
+      {required int sinkId,
+      required int maxWidth,
+      required int maxHeight,
+      required int maxFps,
+      dynamic hint});
+
+  FlutterRustBridgeTaskConstMeta get kSetVideoSinkWantsConstMeta;
+
   DropFnType get dropOpaqueArcPeerConnection;
   ShareFnType get shareOpaqueArcPeerConnection;
   OpaqueTypeFinalizer get ArcPeerConnectionFinalizer;
@@ -439,8 +537,31 @@ class AudioConstraints {
   ///           tracks.
   final String? deviceId;
 
+  /// Indicator whether the echo cancellation is applied to the recorded
+  /// audio.
+  ///
+  /// **NOTE**: Audio processing is configured once the device starts being
+  ///           recorded, and is shared by all the tracks of the device.
+  final bool echoCancellation;
+
+  /// Indicator whether the noise suppression is applied to the recorded
+  /// audio.
+  final bool noiseSuppression;
+
+  /// Indicator whether the automatic gain control is applied to the recorded
+  /// audio.
+  final bool autoGainControl;
+
+  /// Indicator whether the high-pass filter is applied to the recorded
+  /// audio.
+  final bool highPassFilter;
+
   const AudioConstraints({
     this.deviceId,
+    required this.echoCancellation,
+    required this.noiseSuppression,
+    required this.autoGainControl,
+    required this.highPassFilter,
   });
 }
 
@@ -524,6 +645,91 @@ sealed class GetMediaResult with _$GetMediaResult {
   ) = GetMediaResult_Err;
 }
 
+/// Signal produced by fake audio devices.
+enum FakeAudioSignal {
+  /// Digital silence.
+  silence,
+
+  /// Sine tone of the [`FakeMediaOptions::audio_frequency_hz`].
+  sine,
+
+  /// Linear sweep from 100 Hz to 8 kHz, repeated every 5 seconds.
+  sweep,
+
+  /// White noise, repeatable between runs.
+  noise,
+
+  /// Looped contents of the [`FakeMediaOptions::audio_wav_path`] file.
+  wavFile,
+}
+
+/// Media produced by the fake devices enabled via [`enable_fake_media()`].
+class FakeMediaOptions {
+  /// Content of the frames produced by fake video devices.
+  final FakeVideoContent videoContent;
+
+  /// Indicator whether the frames produced by fake video devices are
+  /// overlaid with their number and capture time.
+  final bool videoOverlay;
+
+  /// Signal produced by fake audio devices.
+  final FakeAudioSignal audioSignal;
+
+  /// Frequency of the [`FakeAudioSignal::Sine`], in Hz.
+  final int audioFrequencyHz;
+
+  /// Path to the 16-bit PCM WAV file of the [`FakeAudioSignal::WavFile`].
+  final String audioWavPath;
+
+  /// Interval between the audio markers, in milliseconds, or `0` to not
+  /// emit them.
+  ///
+  /// A marker replaces a whole 10 ms block with a full-scale 2 kHz tone, so
+  /// it's easily detected on the receiving side.
+  final int audioMarkerIntervalMs;
+
+  const FakeMediaOptions({
+    required this.videoContent,
+    required this.videoOverlay,
+    required this.audioSignal,
+    required this.audioFrequencyHz,
+    required this.audioWavPath,
+    required this.audioMarkerIntervalMs,
+  });
+}
+
+/// Content of the frames produced by fake video devices.
+enum FakeVideoContent {
+  /// Black frames.
+  black,
+
+  /// Diagonal color gradient moving with every frame.
+  gradient,
+
+  /// Pseudo-random noise, repeatable between runs.
+  noise,
+}
+
+/// Counters of the buffer pools recycling frames of the screen capturers and
+/// fake video sources.
+class I420BufferPoolStats {
+  /// Total number of buffers reused from the pools.
+  final int hits;
+
+  /// Total number of buffers allocated because no pooled ones were
+  /// available.
+  final int misses;
+
+  /// Maximum number of buffers kept by every pool.
+  final int depth;
+
+  const I420BufferPoolStats({
+    required this.hits,
+    required this.misses,
+    required this.depth,
+  });
+}
+
 /// Properties of a `candidate` in [Section 15.1 of RFC 5245][1].
 /// It corresponds to an [RTCIceTransport] object.
 ///
@@ -1239,6 +1445,27 @@ sealed class RtcOutboundRtpStreamStatsMediaType
   }) = RtcOutboundRtpStreamStatsMediaType_Video;
 }
 
+/// [`RtcStats`] of a single [`PeerConnection`] in an [`RtcStatsBatch`].
+class RtcPeerStats {
+  /// ID of the [`PeerConnection`].
+  final int peerId;
+
+  /// [`RtcStats`] of the [`PeerConnection`].
+  ///
+  /// Empty if they haven't been collected in time.
+  final List<RtcStats> stats;
+
+  /// Indicator whether the [`RtcStats`] of the [`PeerConnection`] haven't
+  /// been collected within the time budget, or have failed to.
+  final bool timedOut;
+
+  const RtcPeerStats({
+    required this.peerId,
+    required this.stats,
+    required this.timedOut,
+  });
+}
+
 /// Representation of [RTCRtpEncodingParameters][0].
 ///
 /// [0]: https://w3.org/TR/webrtc#rtcrtpencodingparameters
@@ -1380,6 +1607,35 @@ class RtcStats {
   });
 }
 
+/// [`RtcStats`] of all the [`PeerConnection`]s, collected at once.
+class RtcStatsBatch {
+  /// [`RtcPeerStats`] of every [`PeerConnection`].
+  final List<RtcPeerStats> peers;
+
+  /// Time spent on collecting this [`RtcStatsBatch`], in microseconds.
+  final int elapsedUs;
+
+  const RtcStatsBatch({
+    required this.peers,
+    required this.elapsedUs,
+  });
+}
+
+/// [`RtcStats`] changed since the previous [`RtcStatsUpdate`], along with the
+/// [`RtcStatsRates`] derived from their previous values.
+class RtcStatsDelta {
+  /// Current [`RtcStats`].
+  final RtcStats stats;
+
+  /// [`RtcStatsRates`] since the previous snapshot of the [`RtcStats`].
+  final RtcStatsRates rates;
+
+  const RtcStatsDelta({
+    required this.stats,
+    required this.rates,
+  });
+}
+
 /// Each candidate pair in the check list has a foundation and a state.
 /// The foundation is the combination of the foundations of the local and remote
 /// candidates in the pair. The state is assigned once the check list for each
@@ -1406,6 +1662,46 @@ enum RtcStatsIceCandidatePairState {
   succeeded,
 }
 
+/// Rates derived from the difference between two consecutive snapshots of the
+/// same [`RtcStats`].
+///
+/// Every rate is [`None`] if the [`RtcStats`] don't have the values it's
+/// derived from, or if they have no previous snapshot.
+class RtcStatsRates {
+  /// Bitrate of the sent or received media, in bits per second.
+  final double? bitrate;
+
+  /// Rate of the sent or received packets, in packets per second.
+  final double? packetRate;
+
+  /// Percentage of the packets lost since the previous snapshot.
+  ///
+  /// For the remote stats it's the last reported fraction of the lost
+  /// packets instead.
+  final double? packetLossPercent;
+
+  /// Rate of the encoded, decoded or captured frames, in frames per second.
+  final double? frameRate;
+
+  /// Change of the jitter since the previous snapshot, in seconds per
+  /// second.
+  ///
+  /// Positive values mean that the jitter grows.
+  final double? jitterTrend;
+
+  /// Number of the video freezes happened since the previous snapshot.
+  final int? newFreezes;
+
+  const RtcStatsRates({
+    this.bitrate,
+    this.packetRate,
+    this.packetLossPercent,
+    this.frameRate,
+    this.jitterTrend,
+    this.newFreezes,
+  });
+}
+
 @freezed
 sealed class RtcStatsType with _$RtcStatsType {
   /// Statistics for the media produced by a [MediaStreamTrack][1] that is
@@ -1744,6 +2040,21 @@ sealed class RtcStatsType with _$RtcStatsType {
   const factory RtcStatsType.unimplemented() = RtcStatsType_Unimplemented;
 }
 
+/// Changes of the [`RtcStats`] of a [`PeerConnection`] since the previous
+/// [`RtcStatsUpdate`] of the same subscription.
+class RtcStatsUpdate {
+  /// [`RtcStats`] which have appeared, or whose values or rates have changed.
+  final List<RtcStatsDelta> changed;
+
+  /// IDs of the [`RtcStats`] which have disappeared.
+  final List<String> removed;
+
+  const RtcStatsUpdate({
+    required this.changed,
+    required this.removed,
+  });
+}
+
 /// Representation of a track event, sent when a new [`MediaStreamTrack`] is
 /// added to an [`RtcRtpTransceiver`] as part of a [`PeerConnection`].
 class RtcTrackEvent {
@@ -1966,6 +2277,26 @@ enum VideoCodec {
   vp9,
 }
 
+/// Configuration of the video codecs of all the [`PeerConnection`]s.
+class VideoCodecConfig {
+  /// Enabled [`VideoCodec`]s in their preference order, the most preferred
+  /// first.
+  ///
+  /// [`VideoCodec`]s not listed here are neither encoded nor decoded, so
+  /// they're never negotiated.
+  final List<VideoCodecSettings> codecs;
+
+  /// Indicator whether VP9 spatial scalability (SVC) modes are supported.
+  ///
+  /// If `false`, only the temporal scalability modes are offered for VP9.
+  final bool vp9Svc;
+
+  const VideoCodecConfig({
+    required this.codecs,
+    required this.vp9Svc,
+  });
+}
+
 /// [`VideoCodec`] info for encoding/decoding.
 class VideoCodecInfo {
   /// Indicator whether hardware acceleration should be used.
@@ -1980,6 +2311,40 @@ class VideoCodecInfo {
   });
 }
 
+/// Settings of a single enabled [`VideoCodec`].
+class VideoCodecSettings {
+  /// Configured [`VideoCodec`].
+  final VideoCodec codec;
+
+  /// [`VideoEncoderComplexity`] of the encoders of this [`VideoCodec`].
+  final VideoEncoderComplexity complexity;
+
+  const VideoCodecSettings({
+    required this.codec,
+    required this.complexity,
+  });
+}
+
+/// Complexity of a video encoder, trading its CPU usage for the quality.
+///
+/// For [`VideoCodec::AV1`] it selects the speed preset of the encoder.
+enum VideoEncoderComplexity {
+  /// Lowest CPU usage.
+  low,
+
+  /// Default complexity of the encoder.
+  normal,
+
+  /// Higher quality at the cost of more CPU usage.
+  high,
+
+  /// Even higher quality at the cost of even more CPU usage.
+  higher,
+
+  /// Highest quality regardless of the CPU usage.
+  max,
+}
+
 /// Nature and settings of the video [`MediaStreamTrack`] returned by
 /// [`Webrtc::get_media()`].
 class VideoConstraints {
@@ -2002,12 +2367,19 @@ class VideoConstraints {
   /// capturing.
   final bool isDisplay;
 
+  /// Maximum share of a single CPU core the screen capturer may spend on
+  /// capturing and converting frames, in percents.
+  ///
+  /// Only applies to screen capturing, defaulting to `50` if [`None`].
+  final int? cpuBudgetPercentage;
+
   const VideoConstraints({
     this.deviceId,
     required this.width,
     required this.height,
     required this.frameRate,
     required this.isDisplay,
+    this.cpuBudgetPercentage,
   });
 }
 
@@ -2054,13 +2426,35 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
         argNames: [],
       );
 
-  Future<void> enableFakeMedia({dynamic hint}) {
+  Future<void> setVideoCodecConfig(
+      {required VideoCodecConfig config, dynamic hint}) {
+    var arg0 = _platform.api2wire_box_autoadd_video_codec_config(config);
     return _platform.executeNormal(FlutterRustBridgeTask(
-      callFfi: (port_) => _platform.inner.wire_enable_fake_media(port_),
+      callFfi: (port_) =>
+          _platform.inner.wire_set_video_codec_config(port_, arg0),
+      parseSuccessData: _wire2api_unit,
+      parseErrorData: _wire2api_FrbAnyhowException,
+      constMeta: kSetVideoCodecConfigConstMeta,
+      argValues: [config],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kSetVideoCodecConfigConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "set_video_codec_config",
+        argNames: ["config"],
+      );
+
+  Future<void> enableFakeMedia(
+      {required FakeMediaOptions options, dynamic hint}) {
+    var arg0 = _platform.api2wire_box_autoadd_fake_media_options(options);
+    return _platform.executeNormal(FlutterRustBridgeTask(
+      callFfi: (port_) => _platform.inner.wire_enable_fake_media(port_, arg0),
       parseSuccessData: _wire2api_unit,
       parseErrorData: null,
       constMeta: kEnableFakeMediaConstMeta,
-      argValues: [],
+      argValues: [options],
       hint: hint,
     ));
   }
@@ -2068,7 +2462,7 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
   FlutterRustBridgeTaskConstMeta get kEnableFakeMediaConstMeta =>
       const FlutterRustBridgeTaskConstMeta(
         debugName: "enable_fake_media",
-        argNames: [],
+        argNames: ["options"],
       );
 
   Future<bool> isFakeMedia({dynamic hint}) {
@@ -2088,6 +2482,42 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
         argNames: [],
       );
 
+  Future<I420BufferPoolStats> i420BufferPoolStats({dynamic hint}) {
+    return _platform.executeNormal(FlutterRustBridgeTask(
+      callFfi: (port_) => _platform.inner.wire_i420_buffer_pool_stats(port_),
+      parseSuccessData: _wire2api_i420_buffer_pool_stats,
+      parseErrorData: null,
+      constMeta: kI420BufferPoolStatsConstMeta,
+      argValues: [],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kI420BufferPoolStatsConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "i420_buffer_pool_stats",
+        argNames: [],
+      );
+
+  Future<void> setI420BufferPoolDepth({required int depth, dynamic hint}) {
+    var arg0 = api2wire_u32(depth);
+    return _platform.executeNormal(FlutterRustBridgeTask(
+      callFfi: (port_) =>
+          _platform.inner.wire_set_i420_buffer_pool_depth(port_, arg0),
+      parseSuccessData: _wire2api_unit,
+      parseErrorData: null,
+      constMeta: kSetI420BufferPoolDepthConstMeta,
+      argValues: [depth],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kSetI420BufferPoolDepthConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "set_i420_buffer_pool_depth",
+        argNames: ["depth"],
+      );
+
   Future<List<MediaDeviceInfo>> enumerateDevices({dynamic hint}) {
     return _platform.executeNormal(FlutterRustBridgeTask(
       callFfi: (port_) => _platform.inner.wire_enumerate_devices(port_),
@@ -2417,6 +2847,77 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
         argNames: ["peer"],
       );
 
+  Future<List<RtcStats>> getPeerStatsFiltered(
+      {required ArcPeerConnection peer,
+      required int typeMask,
+      required List<String> ids,
+      dynamic hint}) {
+    var arg0 = _platform.api2wire_ArcPeerConnection(peer);
+    var arg1 = api2wire_u32(typeMask);
+    var arg2 = _platform.api2wire_StringList(ids);
+    return _platform.executeNormal(FlutterRustBridgeTask(
+      callFfi: (port_) => _platform.inner
+          .wire_get_peer_stats_filtered(port_, arg0, arg1, arg2),
+      parseSuccessData: _wire2api_list_rtc_stats,
+      parseErrorData: _wire2api_FrbAnyhowException,
+      constMeta: kGetPeerStatsFilteredConstMeta,
+      argValues: [peer, typeMask, ids],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kGetPeerStatsFilteredConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "get_peer_stats_filtered",
+        argNames: ["peer", "typeMask", "ids"],
+      );
+
+  Future<RtcStatsBatch> getAllPeersStats(
+      {required int typeMask, required int budgetMs, dynamic hint}) {
+    var arg0 = api2wire_u32(typeMask);
+    var arg1 = api2wire_u32(budgetMs);
+    return _platform.executeNormal(FlutterRustBridgeTask(
+      callFfi: (port_) =>
+          _platform.inner.wire_get_all_peers_stats(port_, arg0, arg1),
+      parseSuccessData: _wire2api_rtc_stats_batch,
+      parseErrorData: null,
+      constMeta: kGetAllPeersStatsConstMeta,
+      argValues: [typeMask, budgetMs],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kGetAllPeersStatsConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "get_all_peers_stats",
+        argNames: ["typeMask", "budgetMs"],
+      );
+
+  Stream<RtcStatsUpdate> subscribePeerStats(
+      {required ArcPeerConnection peer,
+      required int intervalMs,
+      required int typeMask,
+      dynamic hint}) {
+    var arg0 = _platform.api2wire_ArcPeerConnection(peer);
+    var arg1 = api2wire_u32(intervalMs);
+    var arg2 = api2wire_u32(typeMask);
+    return _platform.executeStream(FlutterRustBridgeTask(
+      callFfi: (port_) => _platform.inner
+          .wire_subscribe_peer_stats(port_, arg0, arg1, arg2),
+      parseSuccessData: _wire2api_rtc_stats_update,
+      parseErrorData: _wire2api_FrbAnyhowException,
+      constMeta: kSubscribePeerStatsConstMeta,
+      argValues: [peer, intervalMs, typeMask],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kSubscribePeerStatsConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "subscribe_peer_stats",
+        argNames: ["peer", "intervalMs", "typeMask"],
+      );
+
   Future<void> stopTransceiver(
       {required ArcRtpTransceiver transceiver, dynamic hint}) {
     var arg0 = _platform.api2wire_ArcRtpTransceiver(transceiver);
@@ -2662,6 +3163,25 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
         argNames: [],
       );
 
+  Future<void> setPlayoutBufferDepth({required int buffers, dynamic hint}) {
+    var arg0 = api2wire_u32(buffers);
+    return _platform.executeNormal(FlutterRustBridgeTask(
+      callFfi: (port_) =>
+          _platform.inner.wire_set_playout_buffer_depth(port_, arg0),
+      parseSuccessData: _wire2api_unit,
+      parseErrorData: _wire2api_FrbAnyhowException,
+      constMeta: kSetPlayoutBufferDepthConstMeta,
+      argValues: [buffers],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kSetPlayoutBufferDepthConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "set_playout_buffer_depth",
+        argNames: ["buffers"],
+      );
+
   Future<void> disposeTrack(
       {required String trackId,
       int? peerId,
@@ -2903,6 +3423,33 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
         argNames: ["sinkId"],
       );
 
+  Future<void> setVideoSinkWants(
+      {required int sinkId,
+      required int maxWidth,
+      required int maxHeight,
+      required int maxFps,
+      dynamic hint}) {
+    var arg0 = _platform.api2wire_i64(sinkId);
+    var arg1 = api2wire_i32(maxWidth);
+    var arg2 = api2wire_i32(maxHeight);
+    var arg3 = api2wire_i32(maxFps);
+    return _platform.executeNormal(FlutterRustBridgeTask(
+      callFfi: (port_) => _platform.inner
+          .wire_set_video_sink_wants(port_, arg0, arg1, arg2, arg3),
+      parseSuccessData: _wire2api_unit,
+      parseErrorData: _wire2api_FrbAnyhowException,
+      constMeta: kSetVideoSinkWantsConstMeta,
+      argValues: [sinkId, maxWidth, maxHeight, maxFps],
+      hint: hint,
+    ));
+  }
+
+  FlutterRustBridgeTaskConstMeta get kSetVideoSinkWantsConstMeta =>
+      const FlutterRustBridgeTaskConstMeta(
+        debugName: "set_video_sink_wants",
+        argNames: ["sinkId", "maxWidth", "maxHeight", "maxFps"],
+      );
+
   DropFnType get dropOpaqueArcPeerConnection =>
       _platform.inner.drop_opaque_ArcPeerConnection;
   ShareFnType get shareOpaqueArcPeerConnection =>
@@ -2960,6 +3507,10 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
     return raw as String;
   }
 
+  List<String> _wire2api_StringList(dynamic raw) {
+    return (raw as List<dynamic>).cast<String>();
+  }
+
   (RtcRtpEncodingParameters, ArcRtpEncodingParameters)
       _wire2api___record__rtc_rtp_encoding_parameters_ArcRtpEncodingParameters(
           dynamic raw) {
@@ -3080,6 +3631,17 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
     return raw as int;
   }
 
+  I420BufferPoolStats _wire2api_i420_buffer_pool_stats(dynamic raw) {
+    final arr = raw as List<dynamic>;
+    if (arr.length != 3)
+      throw Exception('unexpected arr length: expect 3 but see ${arr.length}');
+    return I420BufferPoolStats(
+      hits: _wire2api_u64(arr[0]),
+      misses: _wire2api_u64(arr[1]),
+      depth: _wire2api_u32(arr[2]),
+    );
+  }
+
   int _wire2api_i64(dynamic raw) {
     return castInt(raw);
   }
@@ -3133,6 +3695,10 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
     return (raw as List<dynamic>).map(_wire2api_media_stream_track).toList();
   }
 
+  List<RtcPeerStats> _wire2api_list_rtc_peer_stats(dynamic raw) {
+    return (raw as List<dynamic>).map(_wire2api_rtc_peer_stats).toList();
+  }
+
   List<RtcRtpTransceiver> _wire2api_list_rtc_rtp_transceiver(dynamic raw) {
     return (raw as List<dynamic>).map(_wire2api_rtc_rtp_transceiver).toList();
   }
@@ -3141,6 +3707,10 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
     return (raw as List<dynamic>).map(_wire2api_rtc_stats).toList();
   }
 
+  List<RtcStatsDelta> _wire2api_list_rtc_stats_delta(dynamic raw) {
+    return (raw as List<dynamic>).map(_wire2api_rtc_stats_delta).toList();
+  }
+
   List<VideoCodecInfo> _wire2api_list_video_codec_info(dynamic raw) {
     return (raw as List<dynamic>).map(_wire2api_video_codec_info).toList();
   }
@@ -3370,6 +3940,17 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
     }
   }
 
+  RtcPeerStats _wire2api_rtc_peer_stats(dynamic raw) {
+    final arr = raw as List<dynamic>;
+    if (arr.length != 3)
+      throw Exception('unexpected arr length: expect 3 but see ${arr.length}');
+    return RtcPeerStats(
+      peerId: _wire2api_u64(arr[0]),
+      stats: _wire2api_list_rtc_stats(arr[1]),
+      timedOut: _wire2api_bool(arr[2]),
+    );
+  }
+
   RtcRtpEncodingParameters _wire2api_rtc_rtp_encoding_parameters(dynamic raw) {
     final arr = raw as List<dynamic>;
     if (arr.length != 6)
@@ -3429,11 +4010,45 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
     );
   }
 
+  RtcStatsBatch _wire2api_rtc_stats_batch(dynamic raw) {
+    final arr = raw as List<dynamic>;
+    if (arr.length != 2)
+      throw Exception('unexpected arr length: expect 2 but see ${arr.length}');
+    return RtcStatsBatch(
+      peers: _wire2api_list_rtc_peer_stats(arr[0]),
+      elapsedUs: _wire2api_i64(arr[1]),
+    );
+  }
+
+  RtcStatsDelta _wire2api_rtc_stats_delta(dynamic raw) {
+    final arr = raw as List<dynamic>;
+    if (arr.length != 2)
+      throw Exception('unexpected arr length: expect 2 but see ${arr.length}');
+    return RtcStatsDelta(
+      stats: _wire2api_rtc_stats(arr[0]),
+      rates: _wire2api_rtc_stats_rates(arr[1]),
+    );
+  }
+
   RtcStatsIceCandidatePairState _wire2api_rtc_stats_ice_candidate_pair_state(
       dynamic raw) {
     return RtcStatsIceCandidatePairState.values[raw as int];
   }
 
+  RtcStatsRates _wire2api_rtc_stats_rates(dynamic raw) {
+    final arr = raw as List<dynamic>;
+    if (arr.length != 6)
+      throw Exception('unexpected arr length: expect 6 but see ${arr.length}');
+    return RtcStatsRates(
+      bitrate: _wire2api_opt_box_autoadd_f64(arr[0]),
+      packetRate: _wire2api_opt_box_autoadd_f64(arr[1]),
+      packetLossPercent: _wire2api_opt_box_autoadd_f64(arr[2]),
+      frameRate: _wire2api_opt_box_autoadd_f64(arr[3]),
+      jitterTrend: _wire2api_opt_box_autoadd_f64(arr[4]),
+      newFreezes: _wire2api_opt_box_autoadd_u32(arr[5]),
+    );
+  }
+
   RtcStatsType _wire2api_rtc_stats_type(dynamic raw) {
     switch (raw[0]) {
       case 0:
@@ -3508,6 +4123,16 @@ class MedeaFlutterWebrtcNativeImpl implements MedeaFlutterWebrtcNative {
     }
   }
 
+  RtcStatsUpdate _wire2api_rtc_stats_update(dynamic raw) {
+    final arr = raw as List<dynamic>;
+    if (arr.length != 2)
+      throw Exception('unexpected arr length: expect 2 but see ${arr.length}');
+    return RtcStatsUpdate(
+      changed: _wire2api_list_rtc_stats_delta(arr[0]),
+      removed: _wire2api_StringList(arr[1]),
+    );
+  }
+
   RtcTrackEvent _wire2api_rtc_track_event(dynamic raw) {
     final arr = raw as List<dynamic>;
     if (arr.length != 2)
@@ -3608,6 +4233,16 @@ double api2wire_f64(double raw) {
   return raw;
 }
 
+@protected
+int api2wire_fake_audio_signal(FakeAudioSignal raw) {
+  return api2wire_i32(raw.index);
+}
+
+@protected
+int api2wire_fake_video_content(FakeVideoContent raw) {
+  return api2wire_i32(raw.index);
+}
+
 @protected
 int api2wire_i32(int raw) {
   return raw;
@@ -3643,6 +4278,16 @@ int api2wire_u8(int raw) {
   return raw;
 }
 
+@protected
+int api2wire_video_codec(VideoCodec raw) {
+  return api2wire_i32(raw.index);
+}
+
+@protected
+int api2wire_video_encoder_complexity(VideoEncoderComplexity raw) {
+  return api2wire_i32(raw.index);
+}
+
 // Section: finalizer
 
 class MedeaFlutterWebrtcNativePlatform
@@ -3703,6 +4348,14 @@ class MedeaFlutterWebrtcNativePlatform
     return ptr;
   }
 
+  @protected
+  ffi.Pointer<wire_FakeMediaOptions> api2wire_box_autoadd_fake_media_options(
+      FakeMediaOptions raw) {
+    final ptr = inner.new_box_autoadd_fake_media_options_0();
+    _api_fill_to_wire_fake_media_options(raw, ptr.ref);
+    return ptr;
+  }
+
   @protected
   ffi.Pointer<ffi.Double> api2wire_box_autoadd_f64(double raw) {
     return inner.new_box_autoadd_f64_0(api2wire_f64(raw));
@@ -3751,6 +4404,19 @@ class MedeaFlutterWebrtcNativePlatform
     return inner.new_box_autoadd_u64_0(api2wire_u64(raw));
   }
 
+  @protected
+  ffi.Pointer<ffi.Uint8> api2wire_box_autoadd_u8(int raw) {
+    return inner.new_box_autoadd_u8_0(api2wire_u8(raw));
+  }
+
+  @protected
+  ffi.Pointer<wire_VideoCodecConfig> api2wire_box_autoadd_video_codec_config(
+      VideoCodecConfig raw) {
+    final ptr = inner.new_box_autoadd_video_codec_config_0();
+    _api_fill_to_wire_video_codec_config(raw, ptr.ref);
+    return ptr;
+  }
+
   @protected
   ffi.Pointer<wire_VideoConstraints> api2wire_box_autoadd_video_constraints(
       VideoConstraints raw) {
@@ -3800,6 +4466,16 @@ class MedeaFlutterWebrtcNativePlatform
     return ans;
   }
 
+  @protected
+  ffi.Pointer<wire_list_video_codec_settings> api2wire_list_video_codec_settings(
+      List<VideoCodecSettings> raw) {
+    final ans = inner.new_list_video_codec_settings_0(raw.length);
+    for (var i = 0; i < raw.length; ++i) {
+      _api_fill_to_wire_video_codec_settings(raw[i], ans.ref.ptr[i]);
+    }
+    return ans;
+  }
+
   @protected
   ffi.Pointer<wire_uint_8_list> api2wire_opt_String(String? raw) {
     return raw == null ? ffi.nullptr : api2wire_String(raw);
@@ -3828,6 +4504,11 @@ class MedeaFlutterWebrtcNativePlatform
     return raw == null ? ffi.nullptr : api2wire_box_autoadd_u64(raw);
   }
 
+  @protected
+  ffi.Pointer<ffi.Uint8> api2wire_opt_box_autoadd_u8(int? raw) {
+    return raw == null ? ffi.nullptr : api2wire_box_autoadd_u8(raw);
+  }
+
   @protected
   ffi.Pointer<wire_VideoConstraints> api2wire_opt_box_autoadd_video_constraints(
       VideoConstraints? raw) {
@@ -3900,6 +4581,10 @@ class MedeaFlutterWebrtcNativePlatform
   void _api_fill_to_wire_audio_constraints(
       AudioConstraints apiObj, wire_AudioConstraints wireObj) {
     wireObj.device_id = api2wire_opt_String(apiObj.deviceId);
+    wireObj.echo_cancellation = api2wire_bool(apiObj.echoCancellation);
+    wireObj.noise_suppression = api2wire_bool(apiObj.noiseSuppression);
+    wireObj.auto_gain_control = api2wire_bool(apiObj.autoGainControl);
+    wireObj.high_pass_filter = api2wire_bool(apiObj.highPassFilter);
   }
 
   void _api_fill_to_wire_box_autoadd_audio_constraints(
@@ -3907,6 +4592,11 @@ class MedeaFlutterWebrtcNativePlatform
     _api_fill_to_wire_audio_constraints(apiObj, wireObj.ref);
   }
 
+  void _api_fill_to_wire_box_autoadd_fake_media_options(
+      FakeMediaOptions apiObj, ffi.Pointer<wire_FakeMediaOptions> wireObj) {
+    _api_fill_to_wire_fake_media_options(apiObj, wireObj.ref);
+  }
+
   void _api_fill_to_wire_box_autoadd_media_stream_constraints(
       MediaStreamConstraints apiObj,
       ffi.Pointer<wire_MediaStreamConstraints> wireObj) {
@@ -3929,11 +4619,27 @@ class MedeaFlutterWebrtcNativePlatform
     _api_fill_to_wire_rtp_transceiver_init(apiObj, wireObj.ref);
   }
 
+  void _api_fill_to_wire_box_autoadd_video_codec_config(
+      VideoCodecConfig apiObj, ffi.Pointer<wire_VideoCodecConfig> wireObj) {
+    _api_fill_to_wire_video_codec_config(apiObj, wireObj.ref);
+  }
+
   void _api_fill_to_wire_box_autoadd_video_constraints(
       VideoConstraints apiObj, ffi.Pointer<wire_VideoConstraints> wireObj) {
     _api_fill_to_wire_video_constraints(apiObj, wireObj.ref);
   }
 
+  void _api_fill_to_wire_fake_media_options(
+      FakeMediaOptions apiObj, wire_FakeMediaOptions wireObj) {
+    wireObj.video_content = api2wire_fake_video_content(apiObj.videoContent);
+    wireObj.video_overlay = api2wire_bool(apiObj.videoOverlay);
+    wireObj.audio_signal = api2wire_fake_audio_signal(apiObj.audioSignal);
+    wireObj.audio_frequency_hz = api2wire_u32(apiObj.audioFrequencyHz);
+    wireObj.audio_wav_path = api2wire_String(apiObj.audioWavPath);
+    wireObj.audio_marker_interval_ms =
+        api2wire_u32(apiObj.audioMarkerIntervalMs);
+  }
+
   void _api_fill_to_wire_media_stream_constraints(
       MediaStreamConstraints apiObj, wire_MediaStreamConstraints wireObj) {
     wireObj.audio = api2wire_opt_box_autoadd_audio_constraints(apiObj.audio);
@@ -3981,6 +4687,18 @@ class MedeaFlutterWebrtcNativePlatform
         api2wire_list_rtc_rtp_encoding_parameters(apiObj.sendEncodings);
   }
 
+  void _api_fill_to_wire_video_codec_config(
+      VideoCodecConfig apiObj, wire_VideoCodecConfig wireObj) {
+    wireObj.codecs = api2wire_list_video_codec_settings(apiObj.codecs);
+    wireObj.vp9_svc = api2wire_bool(apiObj.vp9Svc);
+  }
+
+  void _api_fill_to_wire_video_codec_settings(
+      VideoCodecSettings apiObj, wire_VideoCodecSettings wireObj) {
+    wireObj.codec = api2wire_video_codec(apiObj.codec);
+    wireObj.complexity = api2wire_video_encoder_complexity(apiObj.complexity);
+  }
+
   void _api_fill_to_wire_video_constraints(
       VideoConstraints apiObj, wire_VideoConstraints wireObj) {
     wireObj.device_id = api2wire_opt_String(apiObj.deviceId);
@@ -3988,6 +4706,8 @@ class MedeaFlutterWebrtcNativePlatform
     wireObj.height = api2wire_u32(apiObj.height);
     wireObj.frame_rate = api2wire_u32(apiObj.frameRate);
     wireObj.is_display = api2wire_bool(apiObj.isDisplay);
+    wireObj.cpu_budget_percentage =
+        api2wire_opt_box_autoadd_u8(apiObj.cpuBudgetPercentage);
   }
 }
 
@@ -4115,19 +4835,40 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
   late final _wire_video_decoders =
       _wire_video_decodersPtr.asFunction<void Function(int)>();
 
+  void wire_set_video_codec_config(
+    int port_,
+    ffi.Pointer<wire_VideoCodecConfig> config,
+  ) {
+    return _wire_set_video_codec_config(
+      port_,
+      config,
+    );
+  }
+
+  late final _wire_set_video_codec_configPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Void Function(
+                  ffi.Int64, ffi.Pointer<wire_VideoCodecConfig>)>>(
+      'wire_set_video_codec_config');
+  late final _wire_set_video_codec_config = _wire_set_video_codec_configPtr
+      .asFunction<void Function(int, ffi.Pointer<wire_VideoCodecConfig>)>();
+
   void wire_enable_fake_media(
     int port_,
+    ffi.Pointer<wire_FakeMediaOptions> options,
   ) {
     return _wire_enable_fake_media(
       port_,
+      options,
     );
   }
 
-  late final _wire_enable_fake_mediaPtr =
-      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int64)>>(
-          'wire_enable_fake_media');
-  late final _wire_enable_fake_media =
-      _wire_enable_fake_mediaPtr.asFunction<void Function(int)>();
+  late final _wire_enable_fake_mediaPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Int64,
+              ffi.Pointer<wire_FakeMediaOptions>)>>('wire_enable_fake_media');
+  late final _wire_enable_fake_media = _wire_enable_fake_mediaPtr
+      .asFunction<void Function(int, ffi.Pointer<wire_FakeMediaOptions>)>();
 
   void wire_is_fake_media(
     int port_,
@@ -4143,6 +4884,37 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
   late final _wire_is_fake_media =
       _wire_is_fake_mediaPtr.asFunction<void Function(int)>();
 
+  void wire_i420_buffer_pool_stats(
+    int port_,
+  ) {
+    return _wire_i420_buffer_pool_stats(
+      port_,
+    );
+  }
+
+  late final _wire_i420_buffer_pool_statsPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int64)>>(
+          'wire_i420_buffer_pool_stats');
+  late final _wire_i420_buffer_pool_stats =
+      _wire_i420_buffer_pool_statsPtr.asFunction<void Function(int)>();
+
+  void wire_set_i420_buffer_pool_depth(
+    int port_,
+    int depth,
+  ) {
+    return _wire_set_i420_buffer_pool_depth(
+      port_,
+      depth,
+    );
+  }
+
+  late final _wire_set_i420_buffer_pool_depthPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int64, ffi.Uint32)>>(
+          'wire_set_i420_buffer_pool_depth');
+  late final _wire_set_i420_buffer_pool_depth =
+      _wire_set_i420_buffer_pool_depthPtr
+          .asFunction<void Function(int, int)>();
+
   void wire_enumerate_devices(
     int port_,
   ) {
@@ -4430,6 +5202,69 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
   late final _wire_get_peer_stats = _wire_get_peer_statsPtr
       .asFunction<void Function(int, wire_ArcPeerConnection)>();
 
+  void wire_get_peer_stats_filtered(
+    int port_,
+    wire_ArcPeerConnection peer,
+    int type_mask,
+    ffi.Pointer<wire_StringList> ids,
+  ) {
+    return _wire_get_peer_stats_filtered(
+      port_,
+      peer,
+      type_mask,
+      ids,
+    );
+  }
+
+  late final _wire_get_peer_stats_filteredPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Int64, wire_ArcPeerConnection, ffi.Uint32,
+              ffi.Pointer<wire_StringList>)>>('wire_get_peer_stats_filtered');
+  late final _wire_get_peer_stats_filtered =
+      _wire_get_peer_stats_filteredPtr.asFunction<
+          void Function(
+              int, wire_ArcPeerConnection, int, ffi.Pointer<wire_StringList>)>();
+
+  void wire_get_all_peers_stats(
+    int port_,
+    int type_mask,
+    int budget_ms,
+  ) {
+    return _wire_get_all_peers_stats(
+      port_,
+      type_mask,
+      budget_ms,
+    );
+  }
+
+  late final _wire_get_all_peers_statsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Int64, ffi.Uint32, ffi.Uint32)>>('wire_get_all_peers_stats');
+  late final _wire_get_all_peers_stats = _wire_get_all_peers_statsPtr
+      .asFunction<void Function(int, int, int)>();
+
+  void wire_subscribe_peer_stats(
+    int port_,
+    wire_ArcPeerConnection peer,
+    int interval_ms,
+    int type_mask,
+  ) {
+    return _wire_subscribe_peer_stats(
+      port_,
+      peer,
+      interval_ms,
+      type_mask,
+    );
+  }
+
+  late final _wire_subscribe_peer_statsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Int64, wire_ArcPeerConnection, ffi.Uint32,
+              ffi.Uint32)>>('wire_subscribe_peer_stats');
+  late final _wire_subscribe_peer_stats = _wire_subscribe_peer_statsPtr
+      .asFunction<void Function(int, wire_ArcPeerConnection, int, int)>();
+
   void wire_stop_transceiver(
     int port_,
     wire_ArcRtpTransceiver transceiver,
@@ -4652,6 +5487,22 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
   late final _wire_microphone_volume =
       _wire_microphone_volumePtr.asFunction<void Function(int)>();
 
+  void wire_set_playout_buffer_depth(
+    int port_,
+    int buffers,
+  ) {
+    return _wire_set_playout_buffer_depth(
+      port_,
+      buffers,
+    );
+  }
+
+  late final _wire_set_playout_buffer_depthPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Int64, ffi.Uint32)>>(
+          'wire_set_playout_buffer_depth');
+  late final _wire_set_playout_buffer_depth =
+      _wire_set_playout_buffer_depthPtr.asFunction<void Function(int, int)>();
+
   void wire_dispose_track(
     int port_,
     ffi.Pointer<wire_uint_8_list> track_id,
@@ -4877,6 +5728,29 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
   late final _wire_dispose_video_sink =
       _wire_dispose_video_sinkPtr.asFunction<void Function(int, int)>();
 
+  void wire_set_video_sink_wants(
+    int port_,
+    int sink_id,
+    int max_width,
+    int max_height,
+    int max_fps,
+  ) {
+    return _wire_set_video_sink_wants(
+      port_,
+      sink_id,
+      max_width,
+      max_height,
+      max_fps,
+    );
+  }
+
+  late final _wire_set_video_sink_wantsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Int64, ffi.Int64, ffi.Int32, ffi.Int32,
+              ffi.Int32)>>('wire_set_video_sink_wants');
+  late final _wire_set_video_sink_wants = _wire_set_video_sink_wantsPtr
+      .asFunction<void Function(int, int, int, int, int)>();
+
   wire_ArcPeerConnection new_ArcPeerConnection() {
     return _new_ArcPeerConnection();
   }
@@ -4956,6 +5830,17 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
   late final _new_box_autoadd_f64_0 = _new_box_autoadd_f64_0Ptr
       .asFunction<ffi.Pointer<ffi.Double> Function(double)>();
 
+  ffi.Pointer<wire_FakeMediaOptions> new_box_autoadd_fake_media_options_0() {
+    return _new_box_autoadd_fake_media_options_0();
+  }
+
+  late final _new_box_autoadd_fake_media_options_0Ptr = _lookup<
+          ffi.NativeFunction<ffi.Pointer<wire_FakeMediaOptions> Function()>>(
+      'new_box_autoadd_fake_media_options_0');
+  late final _new_box_autoadd_fake_media_options_0 =
+      _new_box_autoadd_fake_media_options_0Ptr
+          .asFunction<ffi.Pointer<wire_FakeMediaOptions> Function()>();
+
   ffi.Pointer<ffi.Int32> new_box_autoadd_i32_0(
     int value,
   ) {
@@ -5033,6 +5918,31 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
   late final _new_box_autoadd_u64_0 = _new_box_autoadd_u64_0Ptr
       .asFunction<ffi.Pointer<ffi.Uint64> Function(int)>();
 
+  ffi.Pointer<ffi.Uint8> new_box_autoadd_u8_0(
+    int value,
+  ) {
+    return _new_box_autoadd_u8_0(
+      value,
+    );
+  }
+
+  late final _new_box_autoadd_u8_0Ptr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<ffi.Uint8> Function(ffi.Uint8)>>(
+          'new_box_autoadd_u8_0');
+  late final _new_box_autoadd_u8_0 = _new_box_autoadd_u8_0Ptr
+      .asFunction<ffi.Pointer<ffi.Uint8> Function(int)>();
+
+  ffi.Pointer<wire_VideoCodecConfig> new_box_autoadd_video_codec_config_0() {
+    return _new_box_autoadd_video_codec_config_0();
+  }
+
+  late final _new_box_autoadd_video_codec_config_0Ptr = _lookup<
+          ffi.NativeFunction<ffi.Pointer<wire_VideoCodecConfig> Function()>>(
+      'new_box_autoadd_video_codec_config_0');
+  late final _new_box_autoadd_video_codec_config_0 =
+      _new_box_autoadd_video_codec_config_0Ptr
+          .asFunction<ffi.Pointer<wire_VideoCodecConfig> Function()>();
+
   ffi.Pointer<wire_VideoConstraints> new_box_autoadd_video_constraints_0() {
     return _new_box_autoadd_video_constraints_0();
   }
@@ -5100,6 +6010,22 @@ class MedeaFlutterWebrtcNativeWire implements FlutterRustBridgeWireBase {
       _new_list_rtc_rtp_encoding_parameters_0Ptr.asFunction<
           ffi.Pointer<wire_list_rtc_rtp_encoding_parameters> Function(int)>();
 
+  ffi.Pointer<wire_list_video_codec_settings> new_list_video_codec_settings_0(
+    int len,
+  ) {
+    return _new_list_video_codec_settings_0(
+      len,
+    );
+  }
+
+  late final _new_list_video_codec_settings_0Ptr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<wire_list_video_codec_settings> Function(
+              ffi.Int32)>>('new_list_video_codec_settings_0');
+  late final _new_list_video_codec_settings_0 =
+      _new_list_video_codec_settings_0Ptr.asFunction<
+          ffi.Pointer<wire_list_video_codec_settings> Function(int)>();
+
   ffi.Pointer<wire_uint_8_list> new_uint_8_list_0(
     int len,
   ) {
@@ -5362,6 +6288,40 @@ final class wire_RtcRtpSendParameters extends ffi.Struct {
 
 final class wire_AudioConstraints extends ffi.Struct {
   external ffi.Pointer<wire_uint_8_list> device_id;
+
+  @ffi.Bool()
+  external bool echo_cancellation;
+
+  @ffi.Bool()
+  external bool noise_suppression;
+
+  @ffi.Bool()
+  external bool auto_gain_control;
+
+  @ffi.Bool()
+  external bool high_pass_filter;
+}
+
+final class wire_VideoCodecSettings extends ffi.Struct {
+  @ffi.Int32()
+  external int codec;
+
+  @ffi.Int32()
+  external int complexity;
+}
+
+final class wire_list_video_codec_settings extends ffi.Struct {
+  external ffi.Pointer<wire_VideoCodecSettings> ptr;
+
+  @ffi.Int32()
+  external int len;
+}
+
+final class wire_VideoCodecConfig extends ffi.Struct {
+  external ffi.Pointer<wire_list_video_codec_settings> codecs;
+
+  @ffi.Bool()
+  external bool vp9_svc;
 }
 
 final class wire_VideoConstraints extends ffi.Struct {
@@ -5378,6 +6338,27 @@ final class wire_VideoConstraints extends ffi.Struct {
 
   @ffi.Bool()
   external bool is_display;
+
+  external ffi.Pointer<ffi.Uint8> cpu_budget_percentage;
+}
+
+final class wire_FakeMediaOptions extends ffi.Struct {
+  @ffi.Int32()
+  external int video_content;
+
+  @ffi.Bool()
+  external bool video_overlay;
+
+  @ffi.Int32()
+  external int audio_signal;
+
+  @ffi.Uint32()
+  external int audio_frequency_hz;
+
+  external ffi.Pointer<wire_uint_8_list> audio_wav_path;
+
+  @ffi.Uint32()
+  external int audio_marker_interval_ms;
 }
 
 final class wire_MediaStreamConstraints extends ffi.Struct {
@@ -192,6 +192,43 @@ Future<int> microphoneVolume() async {
   return await api!.microphoneVolume();
 }
 
+/// Sets the number of 10 ms buffers kept queued for the audio playout, trading
+/// the playout latency against the risk of underruns.
+///
+/// Only supported on desktop platforms.
+Future<void> setPlayoutBufferDepth(int buffers) async {
+  if (!isDesktop) {
+    throw UnimplementedError(
+        'setPlayoutBufferDepth() is only supported on desktop platforms');
+  }
+  await api!.setPlayoutBufferDepth(buffers: buffers);
+}
+
+/// Returns the [I420BufferPoolStats] of all the screen capturers and fake
+/// video sources.
+///
+/// Only supported on desktop platforms.
+Future<I420BufferPoolStats> i420BufferPoolStats() async {
+  if (!isDesktop) {
+    throw UnimplementedError(
+        'i420BufferPoolStats() is only supported on desktop platforms');
+  }
+  return I420BufferPoolStats.fromFFI(await api!.i420BufferPoolStats());
+}
+
+/// Sets the maximum number of buffers kept by the pool of every screen
+/// capturer and fake video source.
+///
+/// Zero disables the recycling, so every frame is allocated anew. Only
+/// supported on desktop platforms.
+Future<void> setI420BufferPoolDepth(int depth) async {
+  if (!isDesktop) {
+    throw UnimplementedError(
+        'setI420BufferPoolDepth() is only supported on desktop platforms');
+  }
+  await api!.setI420BufferPoolDepth(depth: depth);
+}
+
 /// [MethodChannel]-based implementation of a [getUserMedia] function.
 Future<List<NativeMediaStreamTrack>> _getUserMediaChannel(
     DeviceConstraints constraints) async {
@@ -210,12 +247,31 @@ Future<List<NativeMediaStreamTrack>> _getUserMediaChannel(
   }
 }
 
+/// Converts the provided [AudioConstraints] into the [ffi.AudioConstraints].
+///
+/// Audio processing not disabled by the constraints is enabled.
+ffi.AudioConstraints _ffiAudioConstraints(
+    DeviceConstraintMap<AudioConstraints> audio) {
+  bool enabled(bool? Function(AudioConstraints) option) {
+    return (audio.mandatory != null ? option(audio.mandatory!) : null) ??
+        (audio.optional != null ? option(audio.optional!) : null) ??
+        true;
+  }
+
+  return ffi.AudioConstraints(
+      deviceId: audio.mandatory?.deviceId,
+      echoCancellation: enabled((c) => c.echoCancellation),
+      noiseSuppression: enabled((c) => c.noiseSuppression),
+      autoGainControl: enabled((c) => c.autoGainControl),
+      highPassFilter: enabled((c) => c.highPassFilter));
+}
+
 /// FFI-based implementation of a [getUserMedia] function.
 Future<List<NativeMediaStreamTrack>> _getUserMediaFFI(
     DeviceConstraints constraints) async {
   var audioConstraints = constraints.audio.mandatory != null ||
           constraints.audio.optional != null
-      ? ffi.AudioConstraints(deviceId: constraints.audio.mandatory?.deviceId)
+      ? _ffiAudioConstraints(constraints.audio)
       : null;
 
   var videoConstraints =
@@ -265,7 +321,7 @@ Future<List<NativeMediaStreamTrack>> _getDisplayMediaFFI(
     DisplayConstraints constraints) async {
   var audioConstraints = constraints.audio.mandatory != null ||
           constraints.audio.optional != null
-      ? ffi.AudioConstraints(deviceId: constraints.audio.mandatory?.deviceId)
+      ? _ffiAudioConstraints(constraints.audio)
       : null;
 
   var videoConstraints =
@@ -281,7 +337,10 @@ Future<List<NativeMediaStreamTrack>> _getDisplayMediaFFI(
               frameRate: constraints.video.mandatory?.fps ??
                   constraints.video.optional?.fps ??
                   defaultFrameRate,
-              isDisplay: true)
+              isDisplay: true,
+              cpuBudgetPercentage:
+                  constraints.video.mandatory?.cpuBudgetPercentage ??
+                      constraints.video.optional?.cpuBudgetPercentage)
           : null;
 
   var result = await api!.getMedia(
@@ -310,9 +369,32 @@ void onDeviceChange(OnDeviceChangeCallback? cb) {
 /// Configures media acquisition to use fake devices instead of actual camera
 /// and microphone.
 ///
+/// Fake video devices produce frames of the provided [videoContent], overlaid
+/// with their number and capture time if [videoOverlay] is `true`.
+///
+/// Fake audio devices produce the provided [audioSignal]: a sine tone of the
+/// [audioFrequencyHz], or the looped contents of the 16-bit PCM WAV file at
+/// the [audioWavPath]. If [audioMarkerIntervalMs] is non-zero, a full-scale
+/// 2 kHz tone replaces a whole 10 ms block every such interval.
+///
 /// This must be called before any other function to work properly.
-Future<void> enableFakeMedia() async {
+Future<void> enableFakeMedia({
+  FakeVideoContent videoContent = FakeVideoContent.black,
+  bool videoOverlay = false,
+  FakeAudioSignal audioSignal = FakeAudioSignal.silence,
+  int audioFrequencyHz = 440,
+  String audioWavPath = '',
+  int audioMarkerIntervalMs = 0,
+}) async {
   if (api != null) {
-    await api!.enableFakeMedia();
+    await api!.enableFakeMedia(
+        options: ffi.FakeMediaOptions(
+      videoContent: ffi.FakeVideoContent.values[videoContent.index],
+      videoOverlay: videoOverlay,
+      audioSignal: ffi.FakeAudioSignal.values[audioSignal.index],
+      audioFrequencyHz: audioFrequencyHz,
+      audioWavPath: audioWavPath,
+      audioMarkerIntervalMs: audioMarkerIntervalMs,
+    ));
   }
 }
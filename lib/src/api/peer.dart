@@ -89,6 +89,38 @@ abstract class PeerConnection {
     }
   }
 
+  /// Enables only the provided [codecs] in their preference order, the most
+  /// preferred first, for all the [PeerConnection]s, and whether VP9 spatial
+  /// scalability modes are supported.
+  ///
+  /// This must be called before any other function to work properly. Throws if
+  /// the [codecs] are empty, contain the same [VideoCodec] twice, or contain
+  /// the unsupported [VideoCodec.H265].
+  static Future<void> setVideoCodecConfig(List<VideoCodecSettings> codecs,
+      {bool vp9Svc = true}) async {
+    if (isDesktop) {
+      await _PeerConnectionFFI.setVideoCodecConfig(codecs, vp9Svc);
+    } else {
+      // TODO: Implement for Channel-based implementation.
+    }
+  }
+
+  /// Returns the [RtcStats] of the [RtcStatsTypeMask] selected types of all
+  /// the [PeerConnection]s at once, waiting for them no longer than the
+  /// provided [budget] in total.
+  ///
+  /// Throws an [UnimplementedError] on mobile platforms.
+  static Future<RtcStatsBatch> getAllStats(
+      int typeMask, Duration budget) async {
+    if (isDesktop) {
+      return await _PeerConnectionFFI.getAllStats(typeMask, budget);
+    } else {
+      // TODO: Implement for Channel-based implementation.
+      throw UnimplementedError(
+          'Stats of all PeerConnections are not supported on this platform');
+    }
+  }
+
   /// Indicator whether the [close] was called.
   bool _closed = false;
 
@@ -205,6 +237,25 @@ abstract class PeerConnection {
   /// Returns all the [RtcStats] of this [PeerConnection].
   Future<List<RtcStats>> getStats();
 
+  /// Returns the [RtcStats] of this [PeerConnection] of the [RtcStatsTypeMask]
+  /// selected types only.
+  ///
+  /// If [ids] are not empty, only the [RtcStats] of the tracks and
+  /// transceivers (by their `mid`s) with these IDs are collected, which throws
+  /// an [UnimplementedError] on mobile platforms.
+  Future<List<RtcStats>> getStatsFiltered(int typeMask,
+      {List<String> ids = const []});
+
+  /// Subscribes to the changes of the [RtcStats] of this [PeerConnection] of
+  /// the [RtcStatsTypeMask] selected types, loaded every [interval].
+  ///
+  /// The first [RtcStatsUpdate] contains all the [RtcStats]. The subscription
+  /// ends once the returned [Stream] is cancelled or this [PeerConnection] is
+  /// closed.
+  ///
+  /// Throws an [UnimplementedError] on mobile platforms.
+  Stream<RtcStatsUpdate> subscribeStats(Duration interval, int typeMask);
+
   /// Sets the provided remote [SessionDescription] to the [PeerConnection].
   Future<void> setRemoteDescription(SessionDescription description);
 
@@ -466,6 +517,28 @@ class _PeerConnectionChannel extends PeerConnection {
 
     return result;
   }
+
+  @override
+  Future<List<RtcStats>> getStatsFiltered(int typeMask,
+      {List<String> ids = const []}) async {
+    if (ids.isNotEmpty) {
+      // TODO: Filter by the `ids` on the native side.
+      throw UnimplementedError(
+          'Stats of the selected tracks are not supported on this platform');
+    }
+
+    var stats = await getStats();
+    return stats
+        .where((s) => RtcStatsTypeMask.contains(typeMask, s.type))
+        .toList();
+  }
+
+  @override
+  Stream<RtcStatsUpdate> subscribeStats(Duration interval, int typeMask) {
+    // TODO: Implement for Channel-based implementation.
+    throw UnimplementedError(
+        'Stats subscriptions are not supported on this platform');
+  }
 }
 
 /// FFI-based implementation of a [PeerConnection].
@@ -524,6 +597,23 @@ class _PeerConnectionFFI extends PeerConnection {
     return res.map((info) => VideoCodecInfo.fromFFI(info)).toList();
   }
 
+  /// Sets the video codec config of all the [PeerConnection]s.
+  static Future<void> setVideoCodecConfig(
+      List<VideoCodecSettings> codecs, bool vp9Svc) async {
+    await api!.setVideoCodecConfig(
+        config: ffi.VideoCodecConfig(
+            codecs: codecs.map((c) => c.toFFI()).toList(), vp9Svc: vp9Svc));
+  }
+
+  /// Returns the [RtcStats] of the [RtcStatsTypeMask] selected types of all
+  /// the [PeerConnection]s at once.
+  static Future<RtcStatsBatch> getAllStats(
+      int typeMask, Duration budget) async {
+    var batch = await api!.getAllPeersStats(
+        typeMask: typeMask, budgetMs: budget.inMilliseconds);
+    return RtcStatsBatch.fromFFI(batch);
+  }
+
   /// Listener for the all [PeerConnection] events received from the native
   /// side.
   void eventListener(ffi.PeerConnectionEvent event) {
@@ -690,4 +780,33 @@ class _PeerConnectionFFI extends PeerConnection {
 
     return result;
   }
+
+  @override
+  Future<List<RtcStats>> getStatsFiltered(int typeMask,
+      {List<String> ids = const []}) async {
+    var stats = await api!
+        .getPeerStatsFiltered(peer: _peer!, typeMask: typeMask, ids: ids);
+    List<RtcStats> result = List.empty(growable: true);
+
+    for (var s in stats) {
+      var stat = RtcStats.fromFFI(s);
+      if (stat != null) {
+        result.add(stat);
+      }
+    }
+
+    return result;
+  }
+
+  @override
+  Stream<RtcStatsUpdate> subscribeStats(Duration interval, int typeMask) {
+    _checkNotClosed();
+
+    return api!
+        .subscribePeerStats(
+            peer: _peer!,
+            intervalMs: interval.inMilliseconds,
+            typeMask: typeMask)
+        .map((update) => RtcStatsUpdate.fromFFI(update));
+  }
 }
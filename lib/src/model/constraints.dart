@@ -27,6 +27,36 @@ enum FacingMode {
   environment,
 }
 
+/// Signal produced by fake audio devices.
+enum FakeAudioSignal {
+  /// Digital silence.
+  silence,
+
+  /// Sine tone of the configured frequency.
+  sine,
+
+  /// Linear sweep from 100 Hz to 8 kHz, repeated every 5 seconds.
+  sweep,
+
+  /// White noise, repeatable between runs.
+  noise,
+
+  /// Looped contents of the configured 16-bit PCM WAV file.
+  wavFile,
+}
+
+/// Content of the frames produced by fake video devices.
+enum FakeVideoContent {
+  /// Black frames.
+  black,
+
+  /// Diagonal color gradient moving with every frame.
+  gradient,
+
+  /// Pseudo-random noise, repeatable between runs.
+  noise,
+}
+
 /// Device audio and video constraints data.
 class DeviceConstraints {
   /// Optional constraints to lookup audio devices with.
@@ -75,6 +105,27 @@ abstract class DeviceMediaConstraints {
 class AudioConstraints implements DeviceMediaConstraints {
   String? deviceId;
 
+  /// Indicator whether the echo cancellation is applied to the recorded audio.
+  ///
+  /// Enabled if not specified.
+  bool? echoCancellation;
+
+  /// Indicator whether the noise suppression is applied to the recorded audio.
+  ///
+  /// Enabled if not specified.
+  bool? noiseSuppression;
+
+  /// Indicator whether the automatic gain control is applied to the recorded
+  /// audio.
+  ///
+  /// Enabled if not specified.
+  bool? autoGainControl;
+
+  /// Indicator whether the high-pass filter is applied to the recorded audio.
+  ///
+  /// Enabled if not specified.
+  bool? highPassFilter;
+
   /// Converts this model to the [Map] expected by Flutter.
   @override
   Map<String, dynamic> toMap() {
@@ -103,6 +154,12 @@ class DeviceVideoConstraints implements DeviceMediaConstraints {
   /// Constraint to search for a device with a concrete FPS.
   int? fps;
 
+  /// Maximum share of a single CPU core the screen capturer may spend on
+  /// capturing and converting frames, in percents.
+  ///
+  /// Only applies to display capturing, defaulting to `50` if not specified.
+  int? cpuBudgetPercentage;
+
   /// Converts this model to the [Map] expected by Flutter.
   @override
   Map<String, dynamic> toMap() {
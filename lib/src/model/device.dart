@@ -60,3 +60,23 @@ class MediaDisplayInfo {
   /// Title of the display.
   late String? title;
 }
+
+/// Counters of the buffer pools recycling frames of the screen capturers and
+/// fake video sources.
+class I420BufferPoolStats {
+  /// Creates [I420BufferPoolStats] basing on the [ffi.I420BufferPoolStats]
+  /// received from the native side.
+  I420BufferPoolStats.fromFFI(ffi.I420BufferPoolStats stats)
+      : hits = stats.hits,
+        misses = stats.misses,
+        depth = stats.depth;
+
+  /// Total number of buffers reused from the pools.
+  final int hits;
+
+  /// Total number of buffers allocated because no pooled ones were available.
+  final int misses;
+
+  /// Maximum number of buffers kept by every pool.
+  final int depth;
+}
@@ -216,3 +216,42 @@ class VideoCodecInfo {
     return VideoCodecInfo(info['isHardwareAccelerated'], mediaCodec);
   }
 }
+
+/// Complexity of a video encoder, trading its CPU usage for the quality.
+///
+/// For [VideoCodec.AV1] it selects the speed preset of the encoder.
+enum VideoEncoderComplexity {
+  /// Lowest CPU usage.
+  low,
+
+  /// Default complexity of the encoder.
+  normal,
+
+  /// Higher quality at the cost of more CPU usage.
+  high,
+
+  /// Even higher quality at the cost of even more CPU usage.
+  higher,
+
+  /// Highest quality regardless of the CPU usage.
+  max,
+}
+
+/// Settings of a single enabled [VideoCodec].
+class VideoCodecSettings {
+  /// Configured [VideoCodec].
+  VideoCodec codec;
+
+  /// [VideoEncoderComplexity] of the encoders of this [VideoCodec].
+  VideoEncoderComplexity complexity;
+
+  VideoCodecSettings(this.codec,
+      {this.complexity = VideoEncoderComplexity.normal});
+
+  /// Converts these [VideoCodecSettings] into the [ffi.VideoCodecSettings].
+  ffi.VideoCodecSettings toFFI() {
+    return ffi.VideoCodecSettings(
+        codec: ffi.VideoCodec.values[codec.index],
+        complexity: ffi.VideoEncoderComplexity.values[complexity.index]);
+  }
+}
@@ -1372,3 +1372,195 @@ class RtcRemoteOutboundRtpStreamStats extends RtcStatsType {
   /// [SSRC]: https://w3.org/TR/webrtc-stats#dfn-ssr
   int? reportsSent;
 }
+
+/// Bits of the `typeMask`s selecting the [RtcStatsType]s to collect.
+abstract class RtcStatsTypeMask {
+  /// [RtcMediaSourceStats].
+  static const int mediaSource = 1 << 0;
+
+  /// [RtcIceCandidateStats].
+  static const int iceCandidate = 1 << 1;
+
+  /// [RtcOutboundRtpStreamStats].
+  static const int outboundRtp = 1 << 2;
+
+  /// [RtcInboundRtpStreamStats].
+  static const int inboundRtp = 1 << 3;
+
+  /// [RtcIceCandidatePairStats].
+  static const int iceCandidatePair = 1 << 4;
+
+  /// [RtcTransportStats].
+  static const int transport = 1 << 5;
+
+  /// [RtcRemoteInboundRtpStreamStats].
+  static const int remoteInboundRtp = 1 << 6;
+
+  /// [RtcRemoteOutboundRtpStreamStats].
+  static const int remoteOutboundRtp = 1 << 7;
+
+  /// All the [RtcStatsType]s.
+  static const int all = 0xFF;
+
+  /// Indicates whether the provided [type] is selected by the [mask].
+  static bool contains(int mask, RtcStatsType type) {
+    int bit;
+    if (type is RtcMediaSourceStats) {
+      bit = mediaSource;
+    } else if (type is RtcIceCandidateStats) {
+      bit = iceCandidate;
+    } else if (type is RtcOutboundRtpStreamStats) {
+      bit = outboundRtp;
+    } else if (type is RtcInboundRtpStreamStats) {
+      bit = inboundRtp;
+    } else if (type is RtcIceCandidatePairStats) {
+      bit = iceCandidatePair;
+    } else if (type is RtcTransportStats) {
+      bit = transport;
+    } else if (type is RtcRemoteInboundRtpStreamStats) {
+      bit = remoteInboundRtp;
+    } else {
+      bit = remoteOutboundRtp;
+    }
+    return (mask & bit) != 0;
+  }
+}
+
+/// Rates derived from the difference between two consecutive snapshots of the
+/// same [RtcStats].
+///
+/// Every rate is `null` if the [RtcStats] don't have the values it's derived
+/// from, or if they have no previous snapshot.
+class RtcStatsRates {
+  RtcStatsRates(
+    this.bitrate,
+    this.packetRate,
+    this.packetLossPercent,
+    this.frameRate,
+    this.jitterTrend,
+    this.newFreezes,
+  );
+
+  /// Creates [RtcStatsRates] basing on the [ffi.RtcStatsRates] received from
+  /// the native side.
+  static RtcStatsRates fromFFI(ffi.RtcStatsRates rates) {
+    return RtcStatsRates(
+      rates.bitrate,
+      rates.packetRate,
+      rates.packetLossPercent,
+      rates.frameRate,
+      rates.jitterTrend,
+      rates.newFreezes,
+    );
+  }
+
+  /// Bitrate of the sent or received media, in bits per second.
+  double? bitrate;
+
+  /// Rate of the sent or received packets, in packets per second.
+  double? packetRate;
+
+  /// Percentage of the packets lost since the previous snapshot.
+  ///
+  /// For the remote stats it's the last reported fraction of the lost packets
+  /// instead.
+  double? packetLossPercent;
+
+  /// Rate of the encoded, decoded or captured frames, in frames per second.
+  double? frameRate;
+
+  /// Change of the jitter since the previous snapshot, in seconds per second.
+  ///
+  /// Positive values mean that the jitter grows.
+  double? jitterTrend;
+
+  /// Number of the video freezes happened since the previous snapshot.
+  int? newFreezes;
+}
+
+/// [RtcStats] changed since the previous [RtcStatsUpdate], along with the
+/// [RtcStatsRates] derived from their previous values.
+class RtcStatsDelta {
+  RtcStatsDelta(this.stats, this.rates);
+
+  /// Current [RtcStats].
+  RtcStats stats;
+
+  /// [RtcStatsRates] since the previous snapshot of the [stats].
+  RtcStatsRates rates;
+}
+
+/// Changes of the [RtcStats] of a `PeerConnection` since the previous
+/// [RtcStatsUpdate] of the same subscription.
+class RtcStatsUpdate {
+  RtcStatsUpdate(this.changed, this.removed);
+
+  /// Creates an [RtcStatsUpdate] basing on the [ffi.RtcStatsUpdate] received
+  /// from the native side.
+  static RtcStatsUpdate fromFFI(ffi.RtcStatsUpdate update) {
+    List<RtcStatsDelta> changed = List.empty(growable: true);
+    for (var delta in update.changed) {
+      var stats = RtcStats.fromFFI(delta.stats);
+      if (stats != null) {
+        changed.add(RtcStatsDelta(stats, RtcStatsRates.fromFFI(delta.rates)));
+      }
+    }
+    return RtcStatsUpdate(changed, update.removed);
+  }
+
+  /// [RtcStats] which have appeared, or whose values or rates have changed.
+  List<RtcStatsDelta> changed;
+
+  /// IDs of the [RtcStats] which have disappeared.
+  List<String> removed;
+}
+
+/// [RtcStats] of a single `PeerConnection` in an [RtcStatsBatch].
+class RtcPeerStats {
+  RtcPeerStats(this.peerId, this.stats, this.timedOut);
+
+  /// Creates [RtcPeerStats] basing on the [ffi.RtcPeerStats] received from the
+  /// native side.
+  static RtcPeerStats fromFFI(ffi.RtcPeerStats peer) {
+    List<RtcStats> stats = List.empty(growable: true);
+    for (var s in peer.stats) {
+      var stat = RtcStats.fromFFI(s);
+      if (stat != null) {
+        stats.add(stat);
+      }
+    }
+    return RtcPeerStats(peer.peerId, stats, peer.timedOut);
+  }
+
+  /// ID of the `PeerConnection`.
+  int peerId;
+
+  /// [RtcStats] of the `PeerConnection`.
+  ///
+  /// Empty if they haven't been collected in time.
+  List<RtcStats> stats;
+
+  /// Indicator whether the [RtcStats] of the `PeerConnection` haven't been
+  /// collected within the time budget, or have failed to.
+  bool timedOut;
+}
+
+/// [RtcStats] of all the `PeerConnection`s, collected at once.
+class RtcStatsBatch {
+  RtcStatsBatch(this.peers, this.elapsedUs);
+
+  /// Creates an [RtcStatsBatch] basing on the [ffi.RtcStatsBatch] received
+  /// from the native side.
+  static RtcStatsBatch fromFFI(ffi.RtcStatsBatch batch) {
+    return RtcStatsBatch(
+      batch.peers.map((p) => RtcPeerStats.fromFFI(p)).toList(),
+      batch.elapsedUs,
+    );
+  }
+
+  /// [RtcPeerStats] of every `PeerConnection`.
+  List<RtcPeerStats> peers;
+
+  /// Time spent on collecting this [RtcStatsBatch], in microseconds.
+  int elapsedUs;
+}
@@ -1,4 +1,5 @@
 import 'dart:async';
+import 'dart:io';
 
 import 'package:flutter/services.dart';
 
@@ -22,6 +23,21 @@ VideoRenderer createPlatformSpecificVideoRenderer() {
 /// [MethodChannel] for factory used for the messaging with the native side.
 final _rendererFactoryChannel = methodChannel('VideoRendererFactory', 0);
 
+/// Indicates whether the native side reports [VideoRenderer]s' statistics.
+bool get _rendererStatsSupported => Platform.isLinux || Platform.isWindows;
+
+/// Returns statistics of the pixel buffers shared between all the
+/// [NativeVideoRenderer]s.
+Future<VideoBufferPoolStats> platformVideoBufferPoolStats() async {
+  if (!_rendererStatsSupported) {
+    throw UnimplementedError(
+        'videoBufferPoolStats() is only supported on Linux and Windows');
+  }
+  final response =
+      await _rendererFactoryChannel.invokeMethod('bufferPoolStats');
+  return VideoBufferPoolStats.fromMap(response);
+}
+
 /// [VideoRenderer] implementation for the native platform.
 abstract class NativeVideoRenderer extends VideoRenderer {
   /// Unique ID for the texture on which video will be rendered.
@@ -169,6 +185,9 @@ class _NativeVideoRendererFFI extends NativeVideoRenderer {
   /// Subscription to the events of this [NativeVideoRenderer].
   Stream<ffi.TextureEvent>? _eventStream;
 
+  /// Constraints set via [setRenderConstraints] as `[width, height, maxFps]`.
+  List<int> _renderConstraints = [0, 0, 0];
+
   @override
   int get videoWidth {
     return value.width.toInt();
@@ -218,7 +237,47 @@ class _NativeVideoRendererFFI extends NativeVideoRenderer {
 
       _eventStream!.listen(eventListener);
       value = value.copyWith(renderVideo: renderVideo);
+
+      if (_renderConstraints.any((c) => c != 0)) {
+        await _applyRenderConstraints();
+      }
+    }
+  }
+
+  @override
+  Future<void> setRenderConstraints({
+    int width = 0,
+    int height = 0,
+    int maxFps = 0,
+  }) async {
+    _renderConstraints = [width, height, maxFps];
+    if (textureId != null && _srcObject != null) {
+      await _applyRenderConstraints();
+    }
+  }
+
+  /// Passes the current [_renderConstraints] to the native side.
+  Future<void> _applyRenderConstraints() async {
+    await api!.setVideoSinkWants(
+      sinkId: textureId!,
+      maxWidth: _renderConstraints[0],
+      maxHeight: _renderConstraints[1],
+      maxFps: _renderConstraints[2],
+    );
+  }
+
+  @override
+  Future<VideoRendererStats> stats() async {
+    if (!_rendererStatsSupported) {
+      return super.stats();
     }
+    if (textureId == null) {
+      throw 'Renderer should be initialize before requesting stats';
+    }
+    final response = await _chan.invokeMethod('textureStats', {
+      'textureId': textureId,
+    });
+    return VideoRendererStats.fromMap(response);
   }
 
   @override
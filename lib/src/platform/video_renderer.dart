@@ -52,6 +52,83 @@ class RTCVideoValue {
       '$runtimeType(width: $width, height: $height, rotation: $rotation)';
 }
 
+/// Frame statistics of a single [VideoRenderer].
+@immutable
+class VideoRendererStats {
+  const VideoRendererStats({
+    this.conversions = 0,
+    this.pulls = 0,
+    this.presentedFrames = 0,
+    this.droppedFrames = 0,
+  });
+
+  /// Creates [VideoRendererStats] basing on the [Map] received from the native
+  /// side.
+  VideoRendererStats.fromMap(dynamic map)
+      : conversions = map['conversions'],
+        pulls = map['pulls'],
+        presentedFrames = map['presentedFrames'],
+        droppedFrames = map['droppedFrames'];
+
+  /// Number of frames converted into the texture's pixel format.
+  final int conversions;
+
+  /// Number of times the texture's pixels were pulled by Flutter.
+  final int pulls;
+
+  /// Number of frames presented on the texture.
+  final int presentedFrames;
+
+  /// Number of frames replaced by newer ones before being presented.
+  final int droppedFrames;
+
+  @override
+  String toString() => '$runtimeType(conversions: $conversions, pulls: $pulls, '
+      'presentedFrames: $presentedFrames, droppedFrames: $droppedFrames)';
+}
+
+/// Statistics of the pixel buffers shared between all the [VideoRenderer]s.
+@immutable
+class VideoBufferPoolStats {
+  const VideoBufferPoolStats({
+    this.allocatedBytes = 0,
+    this.highWaterBytes = 0,
+    this.idleBytes = 0,
+    this.allocations = 0,
+    this.reuses = 0,
+  });
+
+  /// Creates [VideoBufferPoolStats] basing on the [Map] received from the
+  /// native side.
+  VideoBufferPoolStats.fromMap(dynamic map)
+      : allocatedBytes = map['allocatedBytes'],
+        highWaterBytes = map['highWaterBytes'],
+        idleBytes = map['idleBytes'],
+        allocations = map['allocations'],
+        reuses = map['reuses'];
+
+  /// Bytes currently allocated by the pool, including idle buffers.
+  final int allocatedBytes;
+
+  /// Maximum number of bytes ever allocated by the pool at once.
+  final int highWaterBytes;
+
+  /// Bytes of the buffers waiting in the pool to be reused.
+  final int idleBytes;
+
+  /// Number of buffers allocated by the pool.
+  final int allocations;
+
+  /// Number of times an idle buffer was reused instead of allocating a new one.
+  final int reuses;
+
+  @override
+  String toString() =>
+      '$runtimeType(allocatedBytes: $allocatedBytes, highWaterBytes: '
+      '$highWaterBytes, idleBytes: $idleBytes, allocations: $allocations, '
+      'reuses: $reuses)';
+}
+
 abstract class VideoRenderer extends ValueNotifier<RTCVideoValue> {
   VideoRenderer() : super(RTCVideoValue.empty);
 
@@ -87,6 +164,25 @@ abstract class VideoRenderer extends ValueNotifier<RTCVideoValue> {
   /// Assigns the provided media provider object.
   Future<void> setSrcObject(MediaStreamTrack? track);
 
+  /// Sets the size (in physical pixels) this [VideoRenderer] is displayed at,
+  /// and the maximum framerate it should be rendered with, so the video can be
+  /// adapted accordingly.
+  ///
+  /// Zero values mean no constraint. No-op on platforms not supporting it.
+  Future<void> setRenderConstraints({
+    int width = 0,
+    int height = 0,
+    int maxFps = 0,
+  }) async {}
+
+  /// Returns frame statistics of this [VideoRenderer].
+  ///
+  /// Only supported on Linux and Windows.
+  Future<VideoRendererStats> stats() {
+    throw UnimplementedError(
+        'VideoRenderer.stats() is only supported on Linux and Windows');
+  }
+
   @override
   @mustCallSuper
   Future<void> dispose() async {
@@ -103,3 +199,11 @@ enum VideoViewObjectFit {
 VideoRenderer createVideoRenderer() {
   return createPlatformSpecificVideoRenderer();
 }
+
+/// Returns statistics of the pixel buffers shared between all the
+/// [VideoRenderer]s.
+///
+/// Only supported on Linux and Windows.
+Future<VideoBufferPoolStats> videoBufferPoolStats() {
+  return platformVideoBufferPoolStats();
+}
@@ -2,12 +2,22 @@
 
 import 'dart:js';
 
+import '/src/model/constraints.dart' show FakeAudioSignal, FakeVideoContent;
+
 /// Configures media acquisition to use fake devices instead of actual camera
 /// and microphone.
 ///
 /// This must be called before any other function to work properly.
-/// This function is async for identical function signature.
-Future<void> enableFakeMedia() async {
+/// This function is async for identical function signature, and ignores the
+/// provided options.
+Future<void> enableFakeMedia({
+  FakeVideoContent videoContent = FakeVideoContent.black,
+  bool videoOverlay = false,
+  FakeAudioSignal audioSignal = FakeAudioSignal.silence,
+  int audioFrequencyHz = 440,
+  String audioWavPath = '',
+  int audioMarkerIntervalMs = 0,
+}) async {
   context.callMethod('eval', [
     // language=JavaScript
     '''
@@ -29,6 +29,10 @@ VideoRenderer createPlatformSpecificVideoRenderer() {
   return WebVideoRenderer();
 }
 
+Future<VideoBufferPoolStats> platformVideoBufferPoolStats() {
+  throw UnimplementedError('videoBufferPoolStats() is not supported on web');
+}
+
 // An error code value to error name Map.
 // See: https://developer.mozilla.org/en-US/docs/Web/API/MediaError/code
 const Map<int, String> _kErrorValueToErrorName = {
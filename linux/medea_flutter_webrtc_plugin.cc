@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <map>
 #include <mutex>
 #include <optional>
@@ -9,6 +10,7 @@
 #include "include/medea_flutter_webrtc/medea_flutter_webrtc_plugin.h"
 #include <medea_flutter_webrtc_native.h>
 #include <video_texture.h>
+#include "medea-flutter-webrtc-native/include/presentation_scheduler.h"
 
 const char* kChannelName = "FlutterWebRtc/VideoRendererFactory/0";
 
@@ -21,8 +23,9 @@ class TextureVideoRenderer {
  public:
   // Creates a new `TextureVideoRenderer`.
   TextureVideoRenderer(FlTextureRegistrar* registrar,
-                       FlBinaryMessenger* messenger)
-      : registrar_(registrar) {
+                       FlBinaryMessenger* messenger,
+                       PresentationScheduler* scheduler)
+      : registrar_(registrar), scheduler_(scheduler) {
 
     texture_ = video_texture_new();
 
@@ -35,19 +38,18 @@ class TextureVideoRenderer {
   }
 
   void ResetRenderer() {
-    const std::lock_guard<std::mutex> lock(texture_->mutex);
-
-    texture_->frame_.reset();
+    texture_->core->Clear();
   }
 
   // Called when a new `VideoFrame` is produced by the underlying source.
+  //
+  // Publishes the `VideoFrame` to be converted once the raster thread pulls
+  // it. Flutter is notified about it by the `PresentationScheduler` on the
+  // next display refresh.
   void OnFrame(VideoFrame frame) {
-    texture_->mutex.lock();
-    texture_->frame_.emplace(std::move(frame));
-    texture_->mutex.unlock();
+    texture_->core->Publish(std::move(frame));
 
-    fl_texture_registrar_mark_texture_frame_available(registrar_,
-                                                      FL_TEXTURE(texture_));
+    scheduler_->MarkDirty(texture_id_);
   }
 
   // Returns an ID of the Flutter texture associated with this renderer.
@@ -58,6 +60,9 @@ class TextureVideoRenderer {
   // Returns the Flutter texture associated with this renderer.
   VideoTexture* texture() { return texture_; }
 
+  // Returns the conversion and presentation counters of this renderer.
+  RendererStats stats() { return texture_->core->stats(); }
+
  private:
   // Pointer to the `VideoTexture` that is passed to the Flutter texture.
   VideoTexture* texture_ = 0;
@@ -65,10 +70,31 @@ class TextureVideoRenderer {
   // Object keeping track of external textures.
   FlTextureRegistrar* registrar_ = 0;
 
+  // Scheduler notifying Flutter about new frames of this renderer.
+  PresentationScheduler* scheduler_ = 0;
+
   // ID of the Flutter texture.
   int64_t texture_id_ = -1;
 };
 
+// Returns the highest refresh rate of the connected displays in Hz, or `0` if
+// it cannot be determined.
+static double display_refresh_rate() {
+  GdkDisplay* display = gdk_display_get_default();
+  if (display == nullptr) {
+    return 0;
+  }
+
+  double refresh_rate = 0;
+  for (int i = 0; i < gdk_display_get_n_monitors(display); ++i) {
+    GdkMonitor* monitor = gdk_display_get_monitor(display, i);
+    // `gdk_monitor_get_refresh_rate()` returns millihertz.
+    refresh_rate =
+        std::max(refresh_rate, gdk_monitor_get_refresh_rate(monitor) / 1000.0);
+  }
+  return refresh_rate;
+}
+
 class FrameHandler : public OnFrameCallbackInterface {
  public:
   // Creates a new `FrameHandler`.
@@ -88,15 +114,23 @@ class FlutterVideoRendererManager {
  public:
   FlutterVideoRendererManager(FlTextureRegistrar* registrar,
                               FlBinaryMessenger* messenger)
-      : registrar_(registrar), messenger_(messenger) {}
+      : registrar_(registrar),
+        messenger_(messenger),
+        scheduler_(display_refresh_rate(), [registrar](int64_t texture_id) {
+          // ID of a `VideoTexture` is its pointer.
+          fl_texture_registrar_mark_texture_frame_available(
+              registrar, reinterpret_cast<FlTexture*>(texture_id));
+        }) {}
 
   // Creates a new `FlutterVideoRendererManager`.
   void CreateVideoRendererTexture(FlMethodResponse** response) {
     std::shared_ptr<TextureVideoRenderer> renderer =
-        std::make_shared<TextureVideoRenderer>(registrar_, messenger_);
+        std::make_shared<TextureVideoRenderer>(registrar_, messenger_,
+                                               &scheduler_);
 
     auto texture_id = renderer->texture_id();
     renderers_[texture_id] = renderer;
+    scheduler_.Register(texture_id);
 
     g_autoptr(FlValue) map = fl_value_new_map();
     fl_value_set_string_take(map, "textureId",
@@ -125,6 +159,57 @@ class FlutterVideoRendererManager {
     (*response) = FL_METHOD_RESPONSE(fl_method_success_response_new(map));
   }
 
+  // Returns frame counters of the specific `TextureVideoRenderer`.
+  void TextureStats(FlMethodResponse** response, FlMethodCall* method_call) {
+    auto arguments = fl_method_call_get_args(method_call);
+    if (fl_value_get_type(arguments) == FL_VALUE_TYPE_NULL) {
+      (*response) = FL_METHOD_RESPONSE(fl_method_error_response_new(
+          "Bad Arguments", "Null constraints arguments received", NULL));
+      return;
+    }
+    int64_t texture_id =
+        fl_value_get_int(fl_value_lookup_string(arguments, "textureId"));
+
+    auto it = renderers_.find(texture_id);
+    if (it == renderers_.end()) {
+      (*response) = FL_METHOD_RESPONSE(fl_method_error_response_new(
+          "TextureStatsFailed", "TextureStats() texture not found!", NULL));
+      return;
+    }
+
+    RendererStats stats = it->second->stats();
+
+    g_autoptr(FlValue) map = fl_value_new_map();
+    fl_value_set_string_take(map, "conversions",
+                             fl_value_new_int((int64_t)stats.conversions));
+    fl_value_set_string_take(map, "pulls",
+                             fl_value_new_int((int64_t)stats.pulls));
+    fl_value_set_string_take(map, "presentedFrames",
+                             fl_value_new_int((int64_t)stats.presented_frames));
+    fl_value_set_string_take(map, "droppedFrames",
+                             fl_value_new_int((int64_t)stats.dropped_frames));
+    (*response) = FL_METHOD_RESPONSE(fl_method_success_response_new(map));
+  }
+
+  // Returns memory accounting of the `AbgrBufferPool` shared between all the
+  // `TextureVideoRenderer`s.
+  void BufferPoolStats(FlMethodResponse** response) {
+    AbgrBufferPoolStats stats = AbgrBufferPool::Shared().stats();
+
+    g_autoptr(FlValue) map = fl_value_new_map();
+    fl_value_set_string_take(map, "allocatedBytes",
+                             fl_value_new_int((int64_t)stats.allocated_bytes));
+    fl_value_set_string_take(map, "highWaterBytes",
+                             fl_value_new_int((int64_t)stats.high_water_bytes));
+    fl_value_set_string_take(map, "idleBytes",
+                             fl_value_new_int((int64_t)stats.idle_bytes));
+    fl_value_set_string_take(map, "allocations",
+                             fl_value_new_int((int64_t)stats.allocations));
+    fl_value_set_string_take(map, "reuses",
+                             fl_value_new_int((int64_t)stats.reuses));
+    (*response) = FL_METHOD_RESPONSE(fl_method_success_response_new(map));
+  }
+
   // Disposes the specific `TextureVideoRenderer`.
   void VideoRendererDispose(FlMethodResponse** response,
                             FlMethodCall* method_call) {
@@ -139,6 +224,7 @@ class FlutterVideoRendererManager {
 
     auto it = renderers_.find(texture_id);
     if (it != renderers_.end()) {
+      scheduler_.Unregister(texture_id);
       fl_texture_registrar_unregister_texture(
           registrar_, FL_TEXTURE(it->second->texture()));
       renderers_.erase(it);
@@ -157,6 +243,10 @@ class FlutterVideoRendererManager {
   // Channel to the Flutter side renderers.
   FlBinaryMessenger* messenger_;
 
+  // Scheduler coalescing new frames notifications of all the
+  // `TextureVideoRenderer`s.
+  PresentationScheduler scheduler_;
+
   // Map containing all the `TextureVideoRenderer`s.
   std::map<int64_t, std::shared_ptr<TextureVideoRenderer>> renderers_;
 };
@@ -182,6 +272,10 @@ static void medea_flutter_webrtc_plugin_handle_method_call(
     self->video_renderer_manager->VideoRendererDispose(&response, method_call);
   } else if (strcmp(method, "createFrameHandler") == 0) {
     self->video_renderer_manager->CreateFrameHandler(&response, method_call);
+  } else if (strcmp(method, "textureStats") == 0) {
+    self->video_renderer_manager->TextureStats(&response, method_call);
+  } else if (strcmp(method, "bufferPoolStats") == 0) {
+    self->video_renderer_manager->BufferPoolStats(&response);
   } else {
     response = FL_METHOD_RESPONSE(fl_method_not_implemented_response_new());
   }
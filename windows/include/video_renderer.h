@@ -1,7 +1,7 @@
 #pragma once
 
-#include <mutex>
-#include <optional>
+#include <map>
+#include <memory>
 
 #include "flutter/encodable_value.h"
 #include "flutter/event_channel.h"
@@ -9,6 +9,8 @@
 #include "flutter/method_result.h"
 #include "flutter/plugin_registrar.h"
 #include "flutter/texture_registrar.h"
+#include "medea-flutter-webrtc-native/include/presentation_scheduler.h"
+#include "medea-flutter-webrtc-native/include/renderer_core.h"
 #include "medea_flutter_webrtc_native.h"
 
 using namespace flutter;
@@ -40,9 +42,11 @@ inline int64_t findLongInt(const EncodableMap& map, const std::string& key) {
 class TextureVideoRenderer {
  public:
   // Creates a new `TextureVideoRenderer`.
-  TextureVideoRenderer(TextureRegistrar* registrar, BinaryMessenger* messenger);
+  TextureVideoRenderer(TextureRegistrar* registrar,
+                       BinaryMessenger* messenger,
+                       PresentationScheduler* scheduler);
 
-  // Constructs and returns a `FlutterDesktopPixelBuffer` from the current
+  // Returns a `FlutterDesktopPixelBuffer` of the latest converted
   // `VideoFrame`.
   virtual FlutterDesktopPixelBuffer* CopyPixelBuffer(size_t width,
                                                      size_t height);
@@ -56,32 +60,29 @@ class TextureVideoRenderer {
   // Returns an ID of the Flutter texture associated with this renderer.
   int64_t texture_id() { return texture_id_; }
 
- private:
-  // Indicates if at least one `VideoFrame` has been rendered.
-  bool first_frame_rendered = false;
+  // Returns the conversion and presentation counters of this renderer.
+  RendererStats stats() { return core_.stats(); }
 
+ private:
   // Object keeping track of external textures.
   TextureRegistrar* registrar_;
 
+  // Scheduler notifying Flutter about new frames of this renderer.
+  PresentationScheduler* scheduler_;
+
   // ID of the Flutter texture.
   int64_t texture_id_ = -1;
 
-  // ID of the Flutter texture associated with this renderer.
-  std::optional<VideoFrame> frame_;
+  // Core passing the frames that should be rendered.
+  RendererCore<VideoFrame> core_;
 
   // Actual Flutter texture that incoming frames are rendered on.
   std::unique_ptr<flutter::TextureVariant> texture_;
 
-  // Pointer to the `FlutterDesktopPixelBuffer` that is passed to the Flutter
-  // texture.
-  std::unique_ptr<FlutterDesktopPixelBuffer> pixel_buffer_;
-
-  // Raw image buffer.
-  std::unique_ptr<uint8_t> argb_buffer_;
-
-  // Protects the `frame_`, `pixel_buffer_` and `argb_buffer_` fields that are
-  // accessed from multiple threads.
-  std::mutex mutex_;
+  // `FlutterDesktopPixelBuffer` that is passed to the Flutter texture.
+  //
+  // Only accessed from the raster thread.
+  FlutterDesktopPixelBuffer pixel_buffer_ = {};
 };
 
 // Manager storing and managing all the `TextureVideoRenderer`s.
@@ -99,6 +100,16 @@ class FlutterVideoRendererManager {
       const flutter::MethodCall<EncodableValue>& method_call,
       std::unique_ptr<flutter::MethodResult<EncodableValue>> result);
 
+  // Returns frame counters of the specific `TextureVideoRenderer`.
+  void TextureStats(
+      const flutter::MethodCall<EncodableValue>& method_call,
+      std::unique_ptr<flutter::MethodResult<EncodableValue>> result);
+
+  // Returns memory accounting of the `AbgrBufferPool` shared between all the
+  // `TextureVideoRenderer`s.
+  void BufferPoolStats(
+      std::unique_ptr<flutter::MethodResult<EncodableValue>> result);
+
   // Disposes the specific `TextureVideoRenderer`.
   void VideoRendererDispose(
       const flutter::MethodCall<EncodableValue>& method_call,
@@ -111,6 +122,10 @@ class FlutterVideoRendererManager {
   // Channel to the Dart side renderers.
   BinaryMessenger* messenger_;
 
+  // Scheduler coalescing new frames notifications of all the
+  // `TextureVideoRenderer`s.
+  PresentationScheduler scheduler_;
+
   // Map containing all the `TextureVideoRenderer`s.
   std::map<int64_t, std::shared_ptr<TextureVideoRenderer>> renderers_;
 };
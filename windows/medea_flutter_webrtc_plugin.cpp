@@ -55,6 +55,10 @@ void MedeaFlutterWebrtcPlugin::HandleMethodCall(
     VideoRendererDispose(method_call, std::move(result));
   } else if (method.compare("createFrameHandler") == 0) {
     CreateFrameHandler(method_call, std::move(result));
+  } else if (method.compare("textureStats") == 0) {
+    TextureStats(method_call, std::move(result));
+  } else if (method.compare("bufferPoolStats") == 0) {
+    BufferPoolStats(std::move(result));
   } else {
     result->NotImplemented();
   }
@@ -1,3 +1,5 @@
+#include <windows.h>
+
 #include "flutter/method_channel.h"
 #include "flutter/standard_method_codec.h"
 #include "medea_flutter_webrtc_native.h"
@@ -5,20 +7,37 @@
 
 namespace medea_flutter_webrtc {
 
+// Returns the refresh rate of the primary display in Hz, or `0` if it cannot
+// be determined.
+static double display_refresh_rate() {
+  DEVMODE mode = {};
+  mode.dmSize = sizeof(mode);
+  if (!EnumDisplaySettings(nullptr, ENUM_CURRENT_SETTINGS, &mode)) {
+    return 0;
+  }
+  // Values of `0` and `1` stand for the hardware default refresh rate.
+  return mode.dmDisplayFrequency > 1 ? mode.dmDisplayFrequency : 0;
+}
+
 // Creates a new `FlutterVideoRendererManager`.
 FlutterVideoRendererManager::FlutterVideoRendererManager(
     TextureRegistrar* registrar,
     BinaryMessenger* messenger)
-    : registrar_(registrar), messenger_(messenger) {}
+    : registrar_(registrar),
+      messenger_(messenger),
+      scheduler_(display_refresh_rate(), [registrar](int64_t texture_id) {
+        registrar->MarkTextureFrameAvailable(texture_id);
+      }) {}
 
 // Creates a new `TextureVideoRenderer`.
 void FlutterVideoRendererManager::CreateVideoRendererTexture(
     std::unique_ptr<MethodResult<EncodableValue>> result) {
   std::shared_ptr<TextureVideoRenderer> texture(
-      new TextureVideoRenderer(registrar_, messenger_));
+      new TextureVideoRenderer(registrar_, messenger_, &scheduler_));
 
   int64_t texture_id = texture->texture_id();
   renderers_[texture_id] = std::move(texture);
+  scheduler_.Register(texture_id);
   EncodableMap params;
   params[EncodableValue("textureId")] = EncodableValue(texture_id);
 
@@ -43,6 +62,53 @@ void FlutterVideoRendererManager::CreateFrameHandler(
   result->Success(EncodableValue(res));
 }
 
+// Returns frame counters of the specific `TextureVideoRenderer`.
+void FlutterVideoRendererManager::TextureStats(
+    const flutter::MethodCall<EncodableValue>& method_call,
+    std::unique_ptr<flutter::MethodResult<EncodableValue>> result) {
+  if (!method_call.arguments()) {
+    result->Error("Bad Arguments", "Null constraints arguments received");
+    return;
+  }
+  const EncodableMap params = GetValue<EncodableMap>(*method_call.arguments());
+  int64_t texture_id = findLongInt(params, "textureId");
+
+  auto it = renderers_.find(texture_id);
+  if (it == renderers_.end()) {
+    result->Error("TextureStatsFailed", "TextureStats() texture not found!");
+    return;
+  }
+
+  RendererStats stats = it->second->stats();
+  EncodableMap res;
+  res[EncodableValue("conversions")] =
+      EncodableValue((int64_t)stats.conversions);
+  res[EncodableValue("pulls")] = EncodableValue((int64_t)stats.pulls);
+  res[EncodableValue("presentedFrames")] =
+      EncodableValue((int64_t)stats.presented_frames);
+  res[EncodableValue("droppedFrames")] =
+      EncodableValue((int64_t)stats.dropped_frames);
+  result->Success(EncodableValue(res));
+}
+
+// Returns memory accounting of the `AbgrBufferPool` shared between all the
+// `TextureVideoRenderer`s.
+void FlutterVideoRendererManager::BufferPoolStats(
+    std::unique_ptr<flutter::MethodResult<EncodableValue>> result) {
+  AbgrBufferPoolStats stats = AbgrBufferPool::Shared().stats();
+
+  EncodableMap res;
+  res[EncodableValue("allocatedBytes")] =
+      EncodableValue((int64_t)stats.allocated_bytes);
+  res[EncodableValue("highWaterBytes")] =
+      EncodableValue((int64_t)stats.high_water_bytes);
+  res[EncodableValue("idleBytes")] = EncodableValue((int64_t)stats.idle_bytes);
+  res[EncodableValue("allocations")] =
+      EncodableValue((int64_t)stats.allocations);
+  res[EncodableValue("reuses")] = EncodableValue((int64_t)stats.reuses);
+  result->Success(EncodableValue(res));
+}
+
 // Disposes the specific `TextureVideoRenderer`.
 void FlutterVideoRendererManager::VideoRendererDispose(
     const flutter::MethodCall<EncodableValue>& method_call,
@@ -57,6 +123,7 @@ void FlutterVideoRendererManager::VideoRendererDispose(
   auto it = renderers_.find(texture_id);
   if (it != renderers_.end()) {
     std::shared_ptr<TextureVideoRenderer> renderer = it->second;
+    scheduler_.Unregister(texture_id);
     registrar_->UnregisterTexture(texture_id, [renderer] {});
     renderers_.erase(it);
     result->Success();
@@ -68,8 +135,9 @@ void FlutterVideoRendererManager::VideoRendererDispose(
 
 // Creates a new `TextureVideoRenderer`.
 TextureVideoRenderer::TextureVideoRenderer(TextureRegistrar* registrar,
-                                           BinaryMessenger* messenger)
-    : registrar_(registrar) {
+                                           BinaryMessenger* messenger,
+                                           PresentationScheduler* scheduler)
+    : registrar_(registrar), scheduler_(scheduler) {
   texture_ =
       std::make_unique<flutter::TextureVariant>(flutter::PixelBufferTexture(
           [this](size_t width,
@@ -80,54 +148,36 @@ TextureVideoRenderer::TextureVideoRenderer(TextureRegistrar* registrar,
   texture_id_ = registrar_->RegisterTexture(texture_.get());
 }
 
-// Constructs and returns `FlutterDesktopPixelBuffer` from the current
-// `VideoFrame`.
+// Returns `FlutterDesktopPixelBuffer` of the latest converted `VideoFrame`.
+//
+// Frames are converted once when they're pulled for the first time, so
+// repeated pulls without new frames (e.g. caused by repaints of the
+// surrounding UI) don't convert anything.
 FlutterDesktopPixelBuffer* TextureVideoRenderer::CopyPixelBuffer(size_t width,
                                                                  size_t height) {
-  mutex_.lock();
-  if (pixel_buffer_.get() && frame_) {
-    if (pixel_buffer_->width != frame_->width ||
-        pixel_buffer_->height != frame_->height) {
-      size_t buffer_size = frame_->buffer_size;
-      argb_buffer_.reset(new uint8_t[buffer_size]);
-      pixel_buffer_->width = frame_->width;
-      pixel_buffer_->height = frame_->height;
-    }
-
-    frame_->GetABGRBytes(argb_buffer_.get());
-
-    pixel_buffer_->buffer = argb_buffer_.get();
-
-    mutex_.unlock();
-    return pixel_buffer_.get();
+  const FrameSlot& slot = core_.Acquire();
+  if (slot.width == 0 || slot.height == 0) {
+    return nullptr;
   }
-  mutex_.unlock();
-  return nullptr;
+
+  pixel_buffer_.buffer = slot.buffer.data();
+  pixel_buffer_.width = slot.width;
+  pixel_buffer_.height = slot.height;
+
+  return &pixel_buffer_;
 }
 
-// Saves the provided `VideoFrame` and calls
-// `TextureRegistrar->MarkTextureFrameAvailable()` to notify the Flutter side
-// about a new frame being ready for polling.
+// Publishes the provided `VideoFrame` and marks it dirty in the
+// `PresentationScheduler`, which notifies the Flutter side about a new frame
+// being ready for polling on the next display refresh.
 void TextureVideoRenderer::OnFrame(VideoFrame frame) {
-  if (!first_frame_rendered) {
-    pixel_buffer_.reset(new FlutterDesktopPixelBuffer());
-    pixel_buffer_->width = 0;
-    pixel_buffer_->height = 0;
-    first_frame_rendered = true;
-  }
-  mutex_.lock();
-  frame_.emplace(std::move(frame));
-  mutex_.unlock();
-  registrar_->MarkTextureFrameAvailable(texture_id_);
+  core_.Publish(std::move(frame));
+  scheduler_->MarkDirty(texture_id_);
 }
 
 // Resets a `TextureVideoRenderer` to the initial state.
 void TextureVideoRenderer::ResetRenderer() {
-  mutex_.lock();
-  frame_.reset();
-  mutex_.unlock();
-  frame_ = std::nullopt;
-  first_frame_rendered = false;
+  core_.Clear();
 }
 
 // Creates a new `FrameHandler`.